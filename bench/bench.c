@@ -0,0 +1,153 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: agent <agent@local>                        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 02:38:43 by agent             #+#    #+#             */
+/*   Updated: 2026/10/17 03:38:39 by agent            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.h"
+
+volatile sig_atomic_t	g_sgnl;
+
+/**
+ * @brief Prints the CSV header unless the results are appended to a file.
+ * 
+ * `make bench` appends every run to the same file, so the header is only 
+ * written when that file is still empty, or when the output is not a file. 
+ * `make bench` appends the header itself whenever its columns change, so 
+ * the rows of older runs stay under the header they were written with.
+ */
+static void	bench_header(void)
+{
+	struct stat	st;
+
+	if (fstat(STDOUT_FILENO, &st) == 0 && S_ISREG(st.st_mode)
+		&& st.st_size > 0)
+		return ;
+	ft_putstr_fd(BENCH_CSV_HEAD, STDOUT_FILENO);
+}
+
+/**
+ * @brief Times one benchmark and reports it.
+ * 
+ * The operation is repeated in rounds of doubling size until a round takes 
+ * at least `BENCH_MIN_NS`, so quick and slow operations are both measured 
+ * over a long enough interval. Only the last round is reported.
+ * 
+ * @param ms A pointer to the main shell structure passed to `fn`.
+ * @param b A pointer to the benchmark, named with `bench_set`.
+ * @param fn The operation to time, returning `0` on failure.
+ * @param arg The argument passed to `fn`.
+ * 
+ * @return `1` on success, `0` if the operation failed.
+ */
+int	bench_run(t_ms *ms, t_bench *b, t_bench_fn fn, void *arg)
+{
+	long long	start;
+	size_t		i;
+
+	b->iters = 1;
+	while (1)
+	{
+		start = trace_now();
+		i = 0;
+		while (i++ < b->iters)
+		{
+			if (!fn(ms, arg))
+			{
+				ft_printf(STDERR_FILENO, "bench: %s failed\n", b->name);
+				b->failed++;
+				return (0);
+			}
+		}
+		b->ns = trace_now() - start;
+		if (b->ns >= BENCH_MIN_NS || b->iters >= BENCH_MAX_ITERS)
+			break ;
+		b->iters *= 2;
+	}
+	bench_report(b);
+	return (1);
+}
+
+/**
+ * @brief Sets up the shell state the micro benchmarks run against.
+ * 
+ * The shell reads from `/dev/null` in script mode, which keeps the 
+ * history and the terminal out of the way, like `minishell -c` does.
+ * 
+ * @param envp The environment of the benchmark program.
+ * 
+ * @return The initialized shell structure, or NULL on failure.
+ */
+static t_ms	*bench_shell(char **envp)
+{
+	t_reader	*reader;
+
+	reader = reader_init(open("/dev/null", O_RDONLY));
+	if (!reader)
+		return (NULL);
+	return (initialize_struct(envp, reader));
+}
+
+/**
+ * @brief Fills in the benchmark settings from the command line.
+ * 
+ * @param b A pointer to the benchmark.
+ * @param argc The argument count.
+ * @param argv The argument vector: `[revision [shell [megabytes]]]`.
+ * @param envp The environment, passed on to the shell under test.
+ */
+static void	bench_args(t_bench *b, int argc, char **argv, char **envp)
+{
+	ft_memset(b, 0, sizeof(t_bench));
+	b->rev = "unknown";
+	b->shell = BENCH_SHELL;
+	b->envp = envp;
+	b->pump_mb = BENCH_PUMP_MB;
+	if (argc > 1)
+		b->rev = argv[1];
+	if (argc > 2)
+		b->shell = argv[2];
+	if (argc > 3)
+		b->pump_mb = ft_atoi(argv[3]);
+}
+
+/**
+ * @brief Runs every benchmark and writes the results as CSV.
+ * 
+ * Each row carries the revision given as the first argument, so results 
+ * appended across commits can be compared. The second argument is the 
+ * shell the macro benchmarks run, `./minishell` by default, and the third 
+ * the size in mebibytes of the file the `cat_pipe` benchmark copies.
+ * 
+ * @param argc The argument count.
+ * @param argv The argument vector: `[revision [shell [megabytes]]]`.
+ * @param envp The environment, also passed on to the shell under test.
+ * 
+ * @return `0` if every benchmark ran, `1` otherwise.
+ */
+int	main(int argc, char **argv, char **envp)
+{
+	t_ms	*ms;
+	t_bench	b;
+
+	bench_args(&b, argc, argv, envp);
+	ms = bench_shell(envp);
+	if (!ms)
+		return (1);
+	bench_header();
+	bench_lexer(ms, &b);
+	bench_expand(ms, &b);
+	bench_env(ms, &b);
+	bench_path(ms, &b);
+	bench_read(ms, &b);
+	bench_macro(ms, &b);
+	bench_pump(ms, &b);
+	clean_struct(ms);
+	return (b.failed != 0);
+}
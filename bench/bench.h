@@ -0,0 +1,93 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench.h                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: agent <agent@local>                        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 02:38:43 by agent             #+#    #+#             */
+/*   Updated: 2026/10/17 03:17:32 by agent            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef BENCH_H
+# define BENCH_H
+
+# include "../include/minishell.h"
+
+# define BENCH_SHELL "./minishell"
+# define BENCH_CSV_HEAD "rev,benchmark,param,iterations,ns_per_op,mb_per_s,lines_per_s\n"
+# define BENCH_MIN_NS 200000000LL
+# define BENCH_MAX_ITERS 10000000
+# define BENCH_RUNS 5
+# define BENCH_ROW 256
+# define BENCH_INPUT 65536
+# define BENCH_ENV_VARS 1000
+# define BENCH_FILE_LINES 100000
+# define BENCH_GNL_LINES 2000
+# define BENCH_TMP "/tmp/minishell_bench.XXXXXX"
+# define BENCH_LINE "echo \"hi $USER\" 'it''s' > out | grep x$HOME && ls -l ; "
+# define BENCH_WORD "abcdefghijklmnopqrstuvwxyz0123456789_-+.,/"
+# define BENCH_EXPAND "user $USER at $HOME in $PWD, status $? and $NOPE. "
+# define BENCH_SCRIPT_LINE "echo $HOME $PWD > /dev/null\n"
+# define BENCH_PIPE_LINES 10
+# define BENCH_NOOP "/bin/true"
+# define BENCH_HEREDOC_SIZE 65536
+# define BENCH_HEREDOC_BODY "first $HOME\nsecond\nthird $PWD\nfourth\n"
+# define BENCH_PUMP_MB 256
+# define BENCH_PUMP_TAIL " | cat > /dev/null\n"
+# define BENCH_STREAM_TAIL "M | wc -c > /dev/null\n"
+# define BENCH_MB 1048576
+# define BENCH_ECHO_LINES 1000
+# define BENCH_ECHO_TAIL " hello | cat\n"
+
+typedef struct s_bench
+{
+	const char	*rev;
+	const char	*shell;
+	char		**envp;
+	const char	*name;
+	const char	*param;
+	size_t		bytes;
+	size_t		lines;
+	size_t		iters;
+	long long	ns;
+	int			failed;
+	int			pump_mb;
+}	t_bench;
+
+typedef struct s_bench_exp
+{
+	char		*data;
+	char		**lines;
+	t_strbuf	out;
+}	t_bench_exp;
+
+typedef int	(*t_bench_fn)(t_ms *ms, void *arg);
+typedef int	(*t_script_fn)(t_ms *ms, t_strbuf *sb, int n);
+
+//Harness
+int				bench_run(t_ms *ms, t_bench *b, t_bench_fn fn, void *arg);
+void			bench_set(t_bench *b, const char *name, const char *param,
+					size_t bytes);
+void			bench_report(t_bench *b);
+char			*bench_itoa(char *buf, long long n);
+int				bench_fill(t_strbuf *sb, const char *unit, size_t bytes,
+					t_ms *ms);
+
+//Micro benchmarks
+void			bench_lexer(t_ms *ms, t_bench *b);
+void			bench_expand(t_ms *ms, t_bench *b);
+void			bench_env(t_ms *ms, t_bench *b);
+void			bench_path(t_ms *ms, t_bench *b);
+void			bench_read(t_ms *ms, t_bench *b);
+
+//Macro benchmarks
+int				bench_script(t_ms *ms, t_bench *b, t_strbuf *script);
+int				script_lines(t_ms *ms, t_strbuf *sb, int n);
+int				script_pipeline(t_ms *ms, t_strbuf *sb, int k);
+int				script_heredocs(t_ms *ms, t_strbuf *sb, int h);
+void			bench_macro(t_ms *ms, t_bench *b);
+void			bench_pump(t_ms *ms, t_bench *b);
+
+#endif
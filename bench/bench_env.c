@@ -0,0 +1,105 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_env.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: agent <agent@local>                        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 02:38:43 by agent             #+#    #+#             */
+/*   Updated: 2026/10/17 03:07:19 by agent            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.h"
+
+/**
+ * @brief Exports a variable and unsets it again.
+ * 
+ * @param ms A pointer to the main shell structure.
+ * @param arg Unused.
+ * 
+ * @return `1` on success, `0` if either builtin failed.
+ */
+static int	export_once(t_ms *ms, void *arg)
+{
+	char	*export[3];
+	char	*unset[3];
+
+	(void)arg;
+	export[0] = "export";
+	export[1] = "BENCH_VAR=value";
+	export[2] = NULL;
+	unset[0] = "unset";
+	unset[1] = "BENCH_VAR";
+	unset[2] = NULL;
+	handle_export(export, ms);
+	if (ms->exit_status != 0)
+		return (0);
+	handle_unset(unset, ms);
+	return (ms->exit_status == 0);
+}
+
+/**
+ * @brief Grows the environment with `n` exported variables.
+ * 
+ * @param ms A pointer to the main shell structure.
+ * @param n The number of variables to add.
+ * 
+ * @return `1` on success, `0` if an export failed.
+ */
+static int	populate(t_ms *ms, int n)
+{
+	char	*args[3];
+	char	entry[64];
+	char	num[24];
+
+	args[0] = "export";
+	args[1] = entry;
+	args[2] = NULL;
+	while (n-- > 0)
+	{
+		ft_strlcpy(entry, "BENCH_", sizeof(entry));
+		ft_strlcat(entry, bench_itoa(num, n), sizeof(entry));
+		ft_strlcat(entry, "=value", sizeof(entry));
+		handle_export(args, ms);
+		if (ms->exit_status != 0)
+			return (0);
+	}
+	return (1);
+}
+
+/**
+ * @brief Times `export` and `unset` at the current environment size.
+ * 
+ * @param ms A pointer to the main shell structure.
+ * @param b A pointer to the benchmark.
+ * @param size A buffer for the parameter, the number of variables.
+ */
+static void	bench_export(t_ms *ms, t_bench *b, char *size)
+{
+	char	*param;
+
+	param = bench_itoa(size, ms->env.count);
+	bench_set(b, "export_unset", param, 0);
+	bench_run(ms, b, export_once, NULL);
+}
+
+/**
+ * @brief Benchmarks the environment builtins.
+ * 
+ * `export` and `unset` are timed at the inherited environment size and 
+ * again after `BENCH_ENV_VARS` more variables, which shows whether they 
+ * stay independent of the size of the environment.
+ * 
+ * @param ms A pointer to the main shell structure.
+ * @param b A pointer to the benchmark.
+ */
+void	bench_env(t_ms *ms, t_bench *b)
+{
+	char	size[24];
+
+	bench_export(ms, b, size);
+	if (!populate(ms, BENCH_ENV_VARS))
+		b->failed++;
+	bench_export(ms, b, size);
+}
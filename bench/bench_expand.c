@@ -0,0 +1,118 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_expand.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: agent <agent@local>                        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 03:07:19 by agent             #+#    #+#             */
+/*   Updated: 2026/10/17 03:07:19 by agent            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.h"
+
+/**
+ * @brief Expands the variables of one string.
+ * 
+ * @param ms A pointer to the main shell structure.
+ * @param arg A pointer to the input and the reused output builder.
+ * 
+ * @return `1` on success, `0` if memory allocation fails.
+ */
+static int	expand_once(t_ms *ms, void *arg)
+{
+	t_bench_exp	*be;
+	t_expand	exp;
+
+	be = (t_bench_exp *)arg;
+	ft_memset(&exp, 0, sizeof(t_expand));
+	exp.data = be->data;
+	be->out.len = 0;
+	return (expand_to_builder(&exp, ms, &be->out));
+}
+
+/**
+ * @brief Expands a heredoc body line by line.
+ * 
+ * Every line is expanded into the body and terminated with a newline, the 
+ * way the shell builds a heredoc whose limiter is not quoted.
+ * 
+ * @param ms A pointer to the main shell structure.
+ * @param arg A pointer to the body's lines and the reused output builder.
+ * 
+ * @return `1` on success, `0` if memory allocation fails.
+ */
+static int	heredoc_once(t_ms *ms, void *arg)
+{
+	t_bench_exp	*be;
+	t_expand	exp;
+	char		**line;
+
+	be = (t_bench_exp *)arg;
+	be->out.len = 0;
+	line = be->lines;
+	while (*line)
+	{
+		ft_memset(&exp, 0, sizeof(t_expand));
+		exp.data = *line++;
+		if (!expand_to_builder(&exp, ms, &be->out)
+			|| !sb_putc(&be->out, '\n', ms))
+			return (0);
+	}
+	return (1);
+}
+
+/**
+ * @brief Times an expansion over `b->bytes` bytes of repeated input.
+ * 
+ * @param ms A pointer to the main shell structure.
+ * @param b A pointer to the benchmark, named with `bench_set`.
+ * @param unit The text repeated to build the input.
+ * @param fn The expansion to time.
+ */
+static void	run_expand(t_ms *ms, t_bench *b, const char *unit, t_bench_fn fn)
+{
+	t_bench_exp	be;
+	t_strbuf	in;
+	int			ok;
+
+	ft_memset(&be, 0, sizeof(t_bench_exp));
+	ft_memset(&in, 0, sizeof(t_strbuf));
+	ok = sb_init(&in, b->bytes + 1, ms) && bench_fill(&in, unit, b->bytes, ms)
+		&& sb_init(&be.out, 2 * b->bytes, ms);
+	if (ok)
+	{
+		be.data = in.buf;
+		be.lines = ft_split(in.buf, '\n');
+		b->bytes = in.len;
+		ok = (be.lines != NULL);
+	}
+	if (!ok)
+	{
+		ft_printf(STDERR_FILENO, "bench: %s failed\n", b->name);
+		b->failed++;
+	}
+	else
+		bench_run(ms, b, fn, &be);
+	clean_arr(&be.lines);
+	sb_free(&be.out);
+	sb_free(&in);
+}
+
+/**
+ * @brief Benchmarks variable expansion.
+ * 
+ * `expand` expands one 1 KiB word. `heredoc_expand` expands a 64 KiB 
+ * heredoc body, one line at a time into a growing body.
+ * 
+ * @param ms A pointer to the main shell structure.
+ * @param b A pointer to the benchmark.
+ */
+void	bench_expand(t_ms *ms, t_bench *b)
+{
+	bench_set(b, "expand", "1KiB", 1024);
+	run_expand(ms, b, BENCH_EXPAND, expand_once);
+	bench_set(b, "heredoc_expand", "64KiB", BENCH_HEREDOC_SIZE);
+	run_expand(ms, b, BENCH_HEREDOC_BODY, heredoc_once);
+}
@@ -0,0 +1,122 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_lexer.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: agent <agent@local>                        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 02:38:43 by agent             #+#    #+#             */
+/*   Updated: 2026/10/17 02:38:43 by agent            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.h"
+
+/**
+ * @brief Tokenizes one line and drops the line's arena allocations.
+ * 
+ * @param ms A pointer to the main shell structure.
+ * @param arg The line to tokenize.
+ * 
+ * @return `1` on success, `0` on a syntax or allocation error.
+ */
+static int	lex_once(t_ms *ms, void *arg)
+{
+	if (!tokenization((char *)arg, ms))
+		return (0);
+	arena_reset(&ms->arena);
+	return (1);
+}
+
+/**
+ * @brief Scans one run of word characters with the current kernel.
+ * 
+ * @param ms A pointer to the main shell structure holding the kernel.
+ * @param arg The string to scan.
+ * 
+ * @return Always `1`.
+ */
+static int	scan_once(t_ms *ms, void *arg)
+{
+	t_bool	dollar;
+
+	dollar = false;
+	ms->scan((const char *)arg, 0, &dollar);
+	return (1);
+}
+
+/**
+ * @brief Names a scanner kernel.
+ * 
+ * @param scan The kernel.
+ * 
+ * @return The instruction set the kernel is written for.
+ */
+static const char	*scan_name(t_scan scan)
+{
+	if (scan == scan_avx2)
+		return ("avx2");
+	if (scan == scan_sse2)
+		return ("sse2");
+	return ("scalar");
+}
+
+/**
+ * @brief Compares the kernel picked at startup with the scalar scanner.
+ * 
+ * @param ms A pointer to the main shell structure.
+ * @param b A pointer to the benchmark.
+ * @param sb A pointer to a string builder used for the input.
+ */
+static void	bench_scan(t_ms *ms, t_bench *b, t_strbuf *sb)
+{
+	t_scan	best;
+
+	sb->len = 0;
+	if (!bench_fill(sb, BENCH_WORD, BENCH_INPUT, ms))
+	{
+		b->failed++;
+		return ;
+	}
+	best = ms->scan;
+	bench_set(b, "scan", scan_name(best), sb->len);
+	bench_run(ms, b, scan_once, sb->buf);
+	if (best == scan_scalar)
+		return ;
+	ms->scan = scan_scalar;
+	bench_set(b, "scan", scan_name(scan_scalar), sb->len);
+	bench_run(ms, b, scan_once, sb->buf);
+	ms->scan = best;
+}
+
+/**
+ * @brief Benchmarks the lexer and its scanner kernels.
+ * 
+ * The long input is well over `PCACHE_LINE_MAX`, so every iteration runs 
+ * the lexer itself. The short line is served from the parse cache after 
+ * the first iteration, which is what a loop in a script sees.
+ * 
+ * @param ms A pointer to the main shell structure.
+ * @param b A pointer to the benchmark.
+ */
+void	bench_lexer(t_ms *ms, t_bench *b)
+{
+	t_strbuf	sb;
+	char		line[sizeof(BENCH_LINE)];
+
+	if (!sb_init(&sb, BENCH_INPUT, ms)
+		|| !bench_fill(&sb, BENCH_LINE, BENCH_INPUT, ms))
+	{
+		sb_free(&sb);
+		b->failed++;
+		return ;
+	}
+	bench_set(b, "lexer", "64KiB", sb.len);
+	bench_run(ms, b, lex_once, sb.buf);
+	ft_strlcpy(line, BENCH_LINE, sizeof(line));
+	bench_set(b, "lexer_cached", "line", ft_strlen(line));
+	bench_run(ms, b, lex_once, line);
+	bench_scan(ms, b, &sb);
+	sb_free(&sb);
+	clean_token_list(&ms->tokens);
+}
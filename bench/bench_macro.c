@@ -0,0 +1,160 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_macro.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: agent <agent@local>                        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 02:38:43 by agent             #+#    #+#             */
+/*   Updated: 2026/10/17 03:05:28 by agent            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.h"
+
+/**
+ * @brief Writes a generated script to a temporary file.
+ * 
+ * @param script A pointer to the script text.
+ * @param path The `BENCH_TMP` template, replaced by the file's name.
+ * 
+ * @return `1` on success, `0` on failure.
+ */
+static int	write_script(t_strbuf *script, char *path)
+{
+	int	fd;
+	int	ok;
+
+	fd = mkstemp(path);
+	if (fd < 0)
+		return (0);
+	ok = (write(fd, script->buf, script->len) == (ssize_t)script->len);
+	close(fd);
+	if (!ok)
+		unlink(path);
+	return (ok);
+}
+
+/**
+ * @brief Runs the shell under test on a script once.
+ * 
+ * The shell's output goes to `/dev/null`, so only its own work is timed.
+ * 
+ * @param b A pointer to the benchmark, which names the shell.
+ * @param path The path of the script.
+ * 
+ * @return `1` if the shell exited with status `0`, `0` otherwise.
+ */
+static int	run_once(t_bench *b, char *path)
+{
+	char	*argv[3];
+	pid_t	pid;
+	int		status;
+	int		null;
+
+	argv[0] = (char *)b->shell;
+	argv[1] = path;
+	argv[2] = NULL;
+	pid = fork();
+	if (pid < 0)
+		return (0);
+	if (pid == 0)
+	{
+		null = open("/dev/null", O_WRONLY);
+		if (null >= 0 && (dup2(null, STDOUT_FILENO) < 0
+				|| dup2(null, STDERR_FILENO) < 0))
+			exit(1);
+		execve(argv[0], argv, b->envp);
+		exit(127);
+	}
+	if (waitpid(pid, &status, 0) < 0)
+		return (0);
+	return (WIFEXITED(status) && WEXITSTATUS(status) == 0);
+}
+
+/**
+ * @brief Times the shell under test on a generated script.
+ * 
+ * The script is run `BENCH_RUNS` times and the average run is reported. 
+ * Every run starts a new shell, so the time includes its startup.
+ * 
+ * @param ms Unused.
+ * @param b A pointer to the benchmark, named with `bench_set`.
+ * @param script A pointer to the script text.
+ * 
+ * @return `1` on success, `0` if the script could not be run or failed.
+ */
+int	bench_script(t_ms *ms, t_bench *b, t_strbuf *script)
+{
+	char		path[sizeof(BENCH_TMP)];
+	long long	start;
+	int			ok;
+
+	(void)ms;
+	ft_strlcpy(path, BENCH_TMP, sizeof(path));
+	if (!write_script(script, path))
+		return (0);
+	ok = 1;
+	b->iters = 0;
+	start = trace_now();
+	while (ok && b->iters < BENCH_RUNS)
+	{
+		ok = run_once(b, path);
+		b->iters++;
+	}
+	b->ns = trace_now() - start;
+	unlink(path);
+	if (!ok)
+		return (0);
+	bench_report(b);
+	return (1);
+}
+
+/**
+ * @brief Generates a script and times the shell under test on it.
+ * 
+ * @param ms A pointer to the main shell structure.
+ * @param b A pointer to the benchmark, whose name is already set.
+ * @param gen The script generator.
+ * @param n The size passed to the generator, reported as the parameter.
+ */
+static void	run_macro(t_ms *ms, t_bench *b, t_script_fn gen, int n)
+{
+	t_strbuf	script;
+	char		param[24];
+
+	bench_set(b, b->name, bench_itoa(param, n), 0);
+	if (!sb_init(&script, 4096, ms) || !gen(ms, &script, n)
+		|| !bench_script(ms, b, &script))
+	{
+		ft_printf(STDERR_FILENO, "bench: %s failed\n", b->name);
+		b->failed++;
+	}
+	sb_free(&script);
+}
+
+/**
+ * @brief Benchmarks whole runs of the shell on generated scripts.
+ * 
+ * `startup` runs an empty script. The others scale the number of lines, 
+ * the number of external commands in a pipeline, which measures the cost 
+ * of launching them, and the number of heredocs on a single line.
+ * 
+ * @param ms A pointer to the main shell structure.
+ * @param b A pointer to the benchmark.
+ */
+void	bench_macro(t_ms *ms, t_bench *b)
+{
+	b->name = "startup";
+	run_macro(ms, b, script_lines, 0);
+	b->name = "script_lines";
+	run_macro(ms, b, script_lines, 100);
+	run_macro(ms, b, script_lines, 1000);
+	b->name = "pipeline";
+	run_macro(ms, b, script_pipeline, 1);
+	run_macro(ms, b, script_pipeline, 10);
+	run_macro(ms, b, script_pipeline, 100);
+	b->name = "heredocs";
+	run_macro(ms, b, script_heredocs, 16);
+	run_macro(ms, b, script_heredocs, 1000);
+}
@@ -0,0 +1,72 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_path.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: agent <agent@local>                        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 02:38:43 by agent             #+#    #+#             */
+/*   Updated: 2026/10/17 02:38:43 by agent            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.h"
+
+/**
+ * @brief Resolves a command by walking every `PATH` directory.
+ * 
+ * @param ms A pointer to the main shell structure.
+ * @param arg The command name.
+ * 
+ * @return `1` if the command was found, `0` otherwise.
+ */
+static int	search_once(t_ms *ms, void *arg)
+{
+	char	*path;
+
+	path = find_path_from_envp((char *)arg, ms);
+	if (!path)
+		return (0);
+	free(path);
+	return (1);
+}
+
+/**
+ * @brief Resolves a command through the PATH hash table.
+ * 
+ * @param ms A pointer to the main shell structure.
+ * @param arg The command name.
+ * 
+ * @return `1` if the command was found, `0` otherwise.
+ */
+static int	hash_once(t_ms *ms, void *arg)
+{
+	char	*path;
+
+	path = resolve_cmd_path((char *)arg, ms);
+	if (!path)
+		return (0);
+	free(path);
+	return (1);
+}
+
+/**
+ * @brief Benchmarks PATH resolution with and without the hash table.
+ * 
+ * `cat` lives in one of the last usual `PATH` directories, so the plain 
+ * search tries most of them on every call.
+ * 
+ * @param ms A pointer to the main shell structure.
+ * @param b A pointer to the benchmark.
+ */
+void	bench_path(t_ms *ms, t_bench *b)
+{
+	char	cmd[4];
+
+	ft_strlcpy(cmd, "cat", sizeof(cmd));
+	bench_set(b, "path_search", cmd, 0);
+	bench_run(ms, b, search_once, cmd);
+	bench_set(b, "path_hash", cmd, 0);
+	bench_run(ms, b, hash_once, cmd);
+	hash_clear(ms);
+}
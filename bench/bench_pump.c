@@ -0,0 +1,174 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_pump.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: agent <agent@local>                        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 02:51:06 by agent             #+#    #+#             */
+/*   Updated: 2026/10/17 03:17:32 by agent            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.h"
+
+/**
+ * @brief Writes a data file of `mb` mebibytes for the copy benchmark.
+ * 
+ * @param path The `BENCH_TMP` template, replaced by the file's name.
+ * @param mb The size of the file in mebibytes.
+ * 
+ * @return `1` on success, `0` on failure.
+ */
+static int	make_data(char *path, int mb)
+{
+	static char	chunk[BENCH_MB];
+	int			fd;
+	int			ok;
+
+	ft_memset(chunk, 'x', BENCH_MB);
+	chunk[BENCH_MB - 1] = '\n';
+	fd = mkstemp(path);
+	if (fd < 0)
+		return (0);
+	ok = 1;
+	while (ok && mb-- > 0)
+		ok = (write(fd, chunk, BENCH_MB) == BENCH_MB);
+	close(fd);
+	if (!ok)
+		unlink(path);
+	return (ok);
+}
+
+/**
+ * @brief Times a pipeline that copies the data file through `cat`.
+ * 
+ * The parameter is the command of the first stage: a plain `cat` is 
+ * pumped by the shell, while `/bin/cat` is always forked.
+ * 
+ * @param ms A pointer to the main shell structure.
+ * @param b A pointer to the benchmark.
+ * @param cat The command of the first stage.
+ * @param path The path of the data file.
+ */
+static void	run_copy(t_ms *ms, t_bench *b, char *cat, char *path)
+{
+	t_strbuf	script;
+	int			ok;
+
+	bench_set(b, "cat_pipe", cat, (size_t)b->pump_mb * BENCH_MB);
+	ok = sb_init(&script, 256, ms)
+		&& sb_append(&script, cat, ft_strlen(cat), ms)
+		&& sb_append(&script, " ", 1, ms)
+		&& sb_append(&script, path, ft_strlen(path), ms)
+		&& sb_append(&script, BENCH_PUMP_TAIL,
+			sizeof(BENCH_PUMP_TAIL) - 1, ms)
+		&& bench_script(ms, b, &script);
+	if (!ok)
+	{
+		ft_printf(STDERR_FILENO, "bench: cat_pipe %s failed\n", cat);
+		b->failed++;
+	}
+	sb_free(&script);
+}
+
+/**
+ * @brief Times a producer and consumer pipeline with a given pipe size.
+ * 
+ * `yes` streams `pump_mb` mebibytes through `head` into `wc`, with the 
+ * pipes sized by `PIPE_SIZE`, which is also the reported parameter.
+ * 
+ * @param ms A pointer to the main shell structure.
+ * @param b A pointer to the benchmark.
+ * @param size The value of `PIPE_SIZE`.
+ */
+static void	run_stream(t_ms *ms, t_bench *b, char *size)
+{
+	t_strbuf	script;
+	char		buf[24];
+	char		*num;
+	int			ok;
+
+	bench_set(b, "yes_pipe", size, (size_t)b->pump_mb * BENCH_MB);
+	num = bench_itoa(buf, b->pump_mb);
+	ok = sb_init(&script, 256, ms)
+		&& sb_append(&script, "export PIPE_SIZE=", 17, ms)
+		&& sb_append(&script, size, ft_strlen(size), ms)
+		&& sb_append(&script, "\nyes | head -c ", 15, ms)
+		&& sb_append(&script, num, ft_strlen(num), ms)
+		&& sb_append(&script, BENCH_STREAM_TAIL,
+			sizeof(BENCH_STREAM_TAIL) - 1, ms)
+		&& bench_script(ms, b, &script);
+	if (!ok)
+	{
+		ft_printf(STDERR_FILENO, "bench: yes_pipe %s failed\n", size);
+		b->failed++;
+	}
+	sb_free(&script);
+}
+
+/**
+ * @brief Times a script of `echo hello | cat` pipelines.
+ * 
+ * The parameter is the command of the first stage: the builtin `echo` runs 
+ * inside the shell, while `/bin/echo` is forked, as every stage was before 
+ * output-only builtins ran inline. The rate counts pipelines per second.
+ * 
+ * @param ms A pointer to the main shell structure.
+ * @param b A pointer to the benchmark.
+ * @param echo The command of the first stage.
+ */
+static void	run_echo(t_ms *ms, t_bench *b, char *echo)
+{
+	t_strbuf	script;
+	int			i;
+	int			ok;
+
+	bench_set(b, "echo_pipe", echo, 0);
+	b->lines = BENCH_ECHO_LINES;
+	ok = sb_init(&script, 4096, ms);
+	i = 0;
+	while (ok && i++ < BENCH_ECHO_LINES)
+		ok = sb_append(&script, echo, ft_strlen(echo), ms)
+			&& sb_append(&script, BENCH_ECHO_TAIL,
+				sizeof(BENCH_ECHO_TAIL) - 1, ms);
+	if (!ok || !bench_script(ms, b, &script))
+	{
+		ft_printf(STDERR_FILENO, "bench: echo_pipe %s failed\n", echo);
+		b->failed++;
+	}
+	sb_free(&script);
+}
+
+/**
+ * @brief Benchmarks pipelines whose stages the shell runs itself.
+ * 
+ * `echo hello | cat` is timed with the builtin `echo` run inline and with a 
+ * forked `/bin/echo`. A data file of `pump_mb` mebibytes is copied through a 
+ * two stage pipeline, once with the stage pumped by the shell and once with a 
+ * forked `cat`, and the rate is reported in MB/s. The file lives in `/tmp` and 
+ * is removed afterwards; larger sizes need the space there. The same amount is 
+ * then streamed from `yes` with the default pipe size and with 1 MiB pipes.
+ * 
+ * @param ms A pointer to the main shell structure.
+ * @param b A pointer to the benchmark.
+ */
+void	bench_pump(t_ms *ms, t_bench *b)
+{
+	char	path[sizeof(BENCH_TMP)];
+
+	run_echo(ms, b, "echo");
+	run_echo(ms, b, "/bin/echo");
+	ft_strlcpy(path, BENCH_TMP, sizeof(path));
+	if (b->pump_mb <= 0 || !make_data(path, b->pump_mb))
+	{
+		ft_printf(STDERR_FILENO, "bench: cat_pipe failed\n");
+		b->failed++;
+		return ;
+	}
+	run_copy(ms, b, "cat", path);
+	run_copy(ms, b, "/bin/cat", path);
+	unlink(path);
+	run_stream(ms, b, "64k");
+	run_stream(ms, b, "1m");
+}
@@ -0,0 +1,151 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_read.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: agent <agent@local>                        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 02:38:43 by agent             #+#    #+#             */
+/*   Updated: 2026/10/17 03:04:10 by agent            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.h"
+
+/**
+ * @brief Writes the input file for the line reading benchmarks.
+ * 
+ * @param ms A pointer to the main shell structure.
+ * @param path The `BENCH_TMP` template, replaced by the file's name.
+ * @param lines The number of lines to write.
+ * 
+ * @return The size of the file, or `0` on failure.
+ */
+static size_t	make_file(t_ms *ms, char *path, size_t lines)
+{
+	t_strbuf	sb;
+	int			fd;
+	size_t		size;
+
+	size = 0;
+	fd = mkstemp(path);
+	if (fd < 0)
+		return (0);
+	if (sb_init(&sb, 4096, ms) && bench_fill(&sb, BENCH_EXPAND "\n",
+			lines * sizeof(BENCH_EXPAND), ms)
+		&& write(fd, sb.buf, sb.len) == (ssize_t)sb.len)
+		size = sb.len;
+	sb_free(&sb);
+	close(fd);
+	if (!size)
+		unlink(path);
+	return (size);
+}
+
+/**
+ * @brief Reads a whole file with `get_next_line`.
+ * 
+ * @param ms Unused.
+ * @param arg The path of the file.
+ * 
+ * @return `1` on success, `0` if the file could not be opened.
+ */
+static int	gnl_once(t_ms *ms, void *arg)
+{
+	char	*line;
+	int		fd;
+
+	(void)ms;
+	fd = open((char *)arg, O_RDONLY);
+	if (fd < 0)
+		return (0);
+	line = get_next_line(fd);
+	while (line)
+	{
+		free(line);
+		line = get_next_line(fd);
+	}
+	close(fd);
+	return (1);
+}
+
+/**
+ * @brief Reads a whole file with the shell's line reader.
+ * 
+ * @param ms A pointer to the main shell structure.
+ * @param arg The path of the file.
+ * 
+ * @return `1` on success, `0` if the file could not be opened.
+ */
+static int	reader_once(t_ms *ms, void *arg)
+{
+	t_reader	*reader;
+	char		*line;
+	int			fd;
+
+	fd = open((char *)arg, O_RDONLY);
+	if (fd < 0)
+		return (0);
+	reader = reader_init(fd);
+	if (!reader)
+	{
+		close(fd);
+		return (0);
+	}
+	line = reader_next_line(reader, ms);
+	while (line)
+	{
+		free(line);
+		line = reader_next_line(reader, ms);
+	}
+	reader_free(&reader);
+	return (1);
+}
+
+/**
+ * @brief Times one reader on a generated file of `lines` lines.
+ * 
+ * @param ms A pointer to the main shell structure.
+ * @param b A pointer to the benchmark, whose name is already set.
+ * @param fn The reader to time.
+ * @param lines The number of lines in the file.
+ */
+static void	read_file(t_ms *ms, t_bench *b, t_bench_fn fn, size_t lines)
+{
+	char	path[sizeof(BENCH_TMP)];
+	char	num[24];
+	size_t	size;
+
+	ft_strlcpy(path, BENCH_TMP, sizeof(path));
+	size = make_file(ms, path, lines);
+	if (!size)
+	{
+		ft_printf(STDERR_FILENO, "bench: %s failed\n", b->name);
+		b->failed++;
+		return ;
+	}
+	bench_set(b, b->name, bench_itoa(num, lines), size);
+	b->lines = lines;
+	bench_run(ms, b, fn, path);
+	unlink(path);
+}
+
+/**
+ * @brief Benchmarks `get_next_line` against the shell's line reader.
+ * 
+ * The line reader reads a script of `BENCH_FILE_LINES` lines, which is how 
+ * a script reaches the shell, and both rows give their rate in lines per 
+ * second. `get_next_line` copies its whole remaining buffer for every 
+ * line, so it is timed on a file of `BENCH_GNL_LINES` lines only; at the 
+ * full size a single pass takes minutes.
+ * 
+ * @param ms A pointer to the main shell structure.
+ * @param b A pointer to the benchmark.
+ */
+void	bench_read(t_ms *ms, t_bench *b)
+{
+	b->name = "get_next_line";
+	read_file(ms, b, gnl_once, BENCH_GNL_LINES);
+	b->name = "line_reader";
+	read_file(ms, b, reader_once, BENCH_FILE_LINES);
+}
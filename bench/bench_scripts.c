@@ -0,0 +1,112 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_scripts.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: agent <agent@local>                        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 02:38:43 by agent             #+#    #+#             */
+/*   Updated: 2026/10/17 03:05:28 by agent            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.h"
+
+/**
+ * @brief Appends a string to a script.
+ * 
+ * @param ms A pointer to the main shell structure, used for errors.
+ * @param sb A pointer to the string builder receiving the script.
+ * @param s The string to append.
+ * 
+ * @return `1` on success, `0` if memory allocation fails.
+ */
+static int	add(t_ms *ms, t_strbuf *sb, const char *s)
+{
+	return (sb_append(sb, s, ft_strlen(s), ms));
+}
+
+/**
+ * @brief Generates a script of `n` simple commands.
+ * 
+ * @param ms A pointer to the main shell structure, used for errors.
+ * @param sb A pointer to the string builder receiving the script.
+ * @param n The number of lines.
+ * 
+ * @return `1` on success, `0` if memory allocation fails.
+ */
+int	script_lines(t_ms *ms, t_strbuf *sb, int n)
+{
+	return (bench_fill(sb, BENCH_SCRIPT_LINE,
+			n * (sizeof(BENCH_SCRIPT_LINE) - 1), ms));
+}
+
+/**
+ * @brief Generates a script of `BENCH_PIPE_LINES` pipelines of `k` stages.
+ * 
+ * Every stage is the external no-op `BENCH_NOOP`, so each one costs a 
+ * process launch; builtins and `cat` would run inside the shell.
+ * 
+ * @param ms A pointer to the main shell structure, used for errors.
+ * @param sb A pointer to the string builder receiving the script.
+ * @param k The number of commands in each pipeline.
+ * 
+ * @return `1` on success, `0` if memory allocation fails.
+ */
+int	script_pipeline(t_ms *ms, t_strbuf *sb, int k)
+{
+	int	line;
+	int	stage;
+
+	line = 0;
+	while (line++ < BENCH_PIPE_LINES)
+	{
+		if (!add(ms, sb, BENCH_NOOP))
+			return (0);
+		stage = 1;
+		while (stage++ < k)
+		{
+			if (!add(ms, sb, " | " BENCH_NOOP))
+				return (0);
+		}
+		if (!add(ms, sb, "\n"))
+			return (0);
+	}
+	return (1);
+}
+
+/**
+ * @brief Generates a script of one command line with `h` heredocs.
+ * 
+ * Each heredoc has a short body with variables to expand.
+ * 
+ * @param ms A pointer to the main shell structure, used for errors.
+ * @param sb A pointer to the string builder receiving the script.
+ * @param h The number of heredocs, at most the heredoc ceiling.
+ * 
+ * @return `1` on success, `0` if memory allocation fails.
+ */
+int	script_heredocs(t_ms *ms, t_strbuf *sb, int h)
+{
+	char	num[24];
+	int		i;
+
+	if (!add(ms, sb, "cat"))
+		return (0);
+	i = 0;
+	while (i < h)
+	{
+		if (!add(ms, sb, " << E") || !add(ms, sb, bench_itoa(num, i++)))
+			return (0);
+	}
+	if (!add(ms, sb, " > /dev/null\n"))
+		return (0);
+	i = 0;
+	while (i < h)
+	{
+		if (!add(ms, sb, BENCH_HEREDOC_BODY) || !add(ms, sb, "E")
+			|| !add(ms, sb, bench_itoa(num, i++)) || !add(ms, sb, "\n"))
+			return (0);
+	}
+	return (1);
+}
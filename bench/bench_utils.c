@@ -0,0 +1,129 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_utils.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: agent <agent@local>                        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 02:38:43 by agent             #+#    #+#             */
+/*   Updated: 2026/10/17 03:04:10 by agent            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.h"
+
+/**
+ * @brief Formats a non-negative number.
+ * 
+ * @param buf A buffer of at least 24 bytes, filled from its end.
+ * @param n The number to format.
+ * 
+ * @return A pointer to the first digit inside `buf`.
+ */
+char	*bench_itoa(char *buf, long long n)
+{
+	int	i;
+
+	i = 23;
+	buf[i] = '\0';
+	if (n <= 0)
+		buf[--i] = '0';
+	while (n > 0)
+	{
+		buf[--i] = '0' + n % 10;
+		n /= 10;
+	}
+	return (buf + i);
+}
+
+/**
+ * @brief Names the next benchmark.
+ * 
+ * @param b A pointer to the benchmark.
+ * @param name The name of the benchmark, the second CSV column.
+ * @param param The parameters of this run, such as an input size.
+ * @param bytes The input bytes handled by one operation, or `0` when a 
+ *              throughput makes no sense for it.
+ */
+void	bench_set(t_bench *b, const char *name, const char *param,
+	size_t bytes)
+{
+	b->name = name;
+	b->param = param;
+	b->bytes = bytes;
+	b->lines = 0;
+	b->iters = 0;
+	b->ns = 0;
+}
+
+/**
+ * @brief Appends a field and its separator to a CSV row.
+ * 
+ * @param row The row being built, `BENCH_ROW` bytes long.
+ * @param field The field to append.
+ * @param sep The separator that follows it.
+ */
+static void	add_field(char *row, const char *field, const char *sep)
+{
+	ft_strlcat(row, field, BENCH_ROW);
+	ft_strlcat(row, sep, BENCH_ROW);
+}
+
+/**
+ * @brief Writes the result of a benchmark as one CSV row.
+ * 
+ * The time is the average per operation over all iterations. The 
+ * throughput is given in megabytes per second with two decimals, and left 
+ * empty for benchmarks without a meaningful input size. Benchmarks that 
+ * set `lines` also get their rate in lines per second.
+ * 
+ * @param b A pointer to the timed benchmark.
+ */
+void	bench_report(t_bench *b)
+{
+	char		row[BENCH_ROW];
+	char		num[24];
+	long long	rate;
+
+	row[0] = '\0';
+	add_field(row, b->rev, ",");
+	add_field(row, b->name, ",");
+	add_field(row, b->param, ",");
+	add_field(row, bench_itoa(num, b->iters), ",");
+	add_field(row, bench_itoa(num, b->ns / b->iters), ",");
+	if (b->bytes && b->ns > 0)
+	{
+		rate = b->bytes * b->iters * 100000 / b->ns;
+		add_field(row, bench_itoa(num, rate / 100), ".");
+		add_field(row, bench_itoa(num, rate % 100 + 100) + 1, "");
+	}
+	add_field(row, "", ",");
+	if (b->lines && b->ns > 0)
+		add_field(row, bench_itoa(num,
+				b->lines * b->iters * 1000000000LL / b->ns), "");
+	add_field(row, "", "\n");
+	ft_putstr_fd(row, STDOUT_FILENO);
+}
+
+/**
+ * @brief Builds a benchmark input by repeating a snippet.
+ * 
+ * @param sb A pointer to an initialized string builder receiving the input.
+ * @param unit The snippet to repeat.
+ * @param bytes The minimum length of the input.
+ * @param ms A pointer to the main shell structure, used for errors.
+ * 
+ * @return `1` on success, `0` if memory allocation fails.
+ */
+int	bench_fill(t_strbuf *sb, const char *unit, size_t bytes, t_ms *ms)
+{
+	size_t	len;
+
+	len = ft_strlen(unit);
+	while (sb->len < bytes)
+	{
+		if (!sb_append(sb, unit, len, ms))
+			return (0);
+	}
+	return (1);
+}
@@ -22,6 +22,7 @@ LEAKS=0
 
 TESTFILES=""
 COMMAND=$1
+TESTFILE=$2
 
 main() {
 	while [ -n "$2" ]
@@ -57,7 +58,7 @@ main() {
 		esac
 		shift
 	done
-	set "$COMMAND"
+	set -- "$COMMAND" "$TESTFILE"
 	if [[ ! -f $MINISHELL_PATH/$EXECUTABLE ]] ; then
 		echo -e "\033[1;31m# **************************************************************************** #"
 		echo "#                            MINISHELL NOT COMPILED                            #"
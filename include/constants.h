@@ -6,7 +6,7 @@
 /*   By: ssalorin <ssalorin@student.hive.fi>        +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/03/27 12:42:52 by ssalorin          #+#    #+#             */
-/*   Updated: 2025/03/27 12:42:55 by ssalorin         ###   ########.fr       */
+/*   Updated: 2026/10/17 03:37:20 by agent            ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -57,7 +57,11 @@ typedef enum e_token_type
 	WORD = 6,
 	SPACE = 7,
 	END = 8,
-	EMPTY = 9
+	EMPTY = 9,
+	BACKGROUND = 10,
+	SEMI = 11,
+	AND_IF = 12,
+	OR_IF = 13
 }	t_type;
 
 typedef enum e_err
@@ -77,6 +81,7 @@ typedef enum e_print
 	DIRECT,
 	HERED_ERR,
 	HIST_RD_ERR,
+	INPUT_RD_ERR,
 	NO_FILE_OR_DIR,
 	IS_DIR,
 	NO_CMD,
@@ -108,7 +113,23 @@ typedef enum e_mode
 	IGNORE,
 }	t_mode;
 
+typedef enum e_memsub
+{
+	SUB_LEXER,
+	SUB_PARSER,
+	SUB_EXPANSION,
+	SUB_ENV,
+	SUB_HISTORY,
+	SUB_EXEC,
+	SUB_MEMORY,
+	SUB_OTHER,
+	SUB_COUNT,
+}	t_memsub;
+
 # define OWN_ERR_MSG "ms error: "
+# define MS_USAGE "Usage: ./minishell [-c command | file]\n"
+# define OPT_ARG_ERR "option requires an argument\n"
+# define OPT_ERR "invalid option\n"
 # define HISTORY_FILE ".history.tmp"
 # define ERR_MALLOC "memory allocation failed\n"
 # define NO_FD_ERR ": No such file or directory\n"
@@ -123,6 +144,53 @@ typedef enum e_mode
 # define CMDS_ERR "Error: failed to create commands\n"
 # define TOKENS_ERR "Error: failed to create tokens\n"
 # define HEREDOC_ERR "maximum here-document count exceeded\n"
+# define HASH_EMPTY "hash: hash table empty\n"
+# define HASH_NF_ERR ": not found\n"
+# define PCACHE_USAGE "parsecache: usage: parsecache [-r]\n"
+# define JOBS_USAGE "jobs: usage: jobs\n"
+# define TRACE_USAGE "trace: usage: trace [on|off|-r]\n"
+# define MEMSTAT_USAGE "memstat: usage: memstat [-s]\n"
+# define MEMSTAT_OFF_ERR "memstat: not built in (make re MEMSTAT=1)\n"
+# define WAIT_SPEC_ERR "': not a pid or valid job spec\n"
+# define WAIT_CHILD_ERR " is not a child of this shell\n"
+# define WAIT_JOB_ERR ": no such job\n"
+# define DEV_NULL "/dev/null"
 # define HISTORY_SIZE 500
+# define HISTORY_COMPACT 1000
+# define HIST_RING_MIN 16
+# define HIST_BUCKETS 64
+# define HIST_UNLIMITED ((size_t)-1)
+# define HIST_IGNORESPACE 1
+# define HIST_IGNOREDUPS 2
+# define HIST_ERASEDUPS 4
+# define READER_SIZE 65536
+# define HASH_SIZE 64
+# define ARENA_CHUNK 16384
+# define ARENA_ALIGN 16
+# define STRBUF_SIZE 64
+# define TOKENS_MIN 64
+# define PCACHE_SIZE 64
+# define PCACHE_BUCKETS 128
+# define PCACHE_LINE_MAX 4096
+# define TRACE_MIN 256
+# define TRACE_MAX 65536
+# define TIMED 1
+# define TIMED_POSIX 2
+# define SYSTEM_CAT "/bin/cat"
+# define PUMP_CHUNK 1048576
+# define PUMP_BUF 65536
+# define MEMSTAT_SITES 1024
+# define MEMSTAT_SLOTS 2048
+# define MEMSTAT_BUCKETS 4096
+# define MEMSTAT_NO_SITES 0
+# define MEMSTAT_ALL_SITES 1
+# define MEMSTAT_LIVE_SITES 2
+# define ENV_BUCKETS 64
+# define HEREDOC_TMPDIR "/tmp"
+# define HEREDOC_MAX 1024
+# define HEREDOC_MAX_VAR "HEREDOC_MAX"
+# define PIPE_SIZE_VAR "PIPE_SIZE"
+# define PIPE_MAX_PATH "/proc/sys/fs/pipe-max-size"
+# define PIPE_MAX_DEFAULT 1048576
 
 #endif
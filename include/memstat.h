@@ -0,0 +1,36 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   memstat.h                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: agent <agent@local>                        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 02:44:16 by agent             #+#    #+#             */
+/*   Updated: 2026/10/17 02:44:16 by agent            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef MEMSTAT_H
+# define MEMSTAT_H
+
+/*
+ * Allocation accounting, built in with `make re MEMSTAT=1`. Every `malloc` 
+ * and libft allocation of the shell is then recorded at its call site. This 
+ * header comes last in minishell.h, after every declaration it renames.
+ */
+# ifdef MEMSTAT
+#  define MEMSTAT_ON 1
+#  define MEMSTAT_AT __FILE__, __LINE__
+#  define malloc(size) memstat_malloc(size, MEMSTAT_AT)
+#  define free(ptr) memstat_free(ptr)
+#  define ft_calloc(n, size) memstat_keep(ft_calloc(n, size), MEMSTAT_AT)
+#  define ft_strdup(s) memstat_keep(ft_strdup(s), MEMSTAT_AT)
+#  define ft_strjoin(a, b) memstat_keep(ft_strjoin(a, b), MEMSTAT_AT)
+#  define ft_substr(s, i, n) memstat_keep(ft_substr(s, i, n), MEMSTAT_AT)
+#  define ft_itoa(n) memstat_keep(ft_itoa(n), MEMSTAT_AT)
+#  define ft_split(s, c) memstat_split(ft_split(s, c), MEMSTAT_AT)
+# else
+#  define MEMSTAT_ON 0
+# endif
+
+#endif
@@ -6,7 +6,7 @@
 /*   By: ssalorin <ssalorin@student.hive.fi>        +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/03/27 12:39:13 by ssalorin          #+#    #+#             */
-/*   Updated: 2025/03/27 12:39:20 by ssalorin         ###   ########.fr       */
+/*   Updated: 2026/10/17 03:16:31 by agent            ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -14,6 +14,9 @@
 # define MINISHELL_H
 
 # include <sys/types.h>
+# include <stdint.h>
+# include <sys/resource.h>
+# include <time.h>
 # include "constants.h"
 # include "structs.h"
 # include "../libft/include/libft.h"
@@ -29,33 +32,22 @@
 # include <readline/history.h>
 # include <signal.h>
 # include <termios.h>
+# include <spawn.h>
 
 extern volatile sig_atomic_t	g_sgnl;
 
-//BNF
-char			*validate_word(char *str, int *err_flag);
-char			*validate_redirect(char *str, int *err_flag);
-char			*validate_simple_cmd(char *str, int *err_flag);
-char			*validate_cmd(char *str, int *err_flag);
-char			*validate_pipeline(char *str, int *err_flag);
-int				validate_input(char *str);
-int				ft_special(int c);
-
 //BUILTINS
 void			handle_echo(char **args, t_ms *ms);
 void			handle_env(char **args, t_ms *ms);
 void			print_exported(t_ms *ms);
 void			add_to_exported(char *key, t_ms *ms);
-void			sort_exported_alphaorder(t_ms *ms);
 void			handle_export(char **args, t_ms *ms);
 void			change_values_env_ex(char *arg, t_ms *ms);
 void			handle_unset(char **args, t_ms *ms);
-int				check_env(char *env, char *name, int len, int flag);
-char			**allocate_temp_env(char **env, int x);
-void			print_array(char **a);
 int				check_if_valid_key(char *name);
 int				get_key_length(char *arg);
 char			*extract_key(char *arg, int len);
+void			print_array(char **a);
 void			handle_cd(char **args, t_ms *ms);
 void			update_env_var(t_ms *ms, char *key, char *new_value);
 char			*build_relative_path(char *target, char *cwd, t_ms *ms);
@@ -63,57 +55,68 @@ char			*get_parent_directory(t_ms *ms);
 char			*get_oldpwd_directory(t_ms *ms);
 char			*get_home_directory(t_ms *ms, int flag);
 void			check_pwd(t_ms *ms);
-char			*get_env_value(char *key, char **envp);
+char			*get_env_value(char *key, t_ms *ms);
 void			check_exit(char	**array, t_ms *ms);
 long long		convert_to_ll(char *str, int *error);
-char			*handle_expansion(t_expand *exp, t_ms *ms);
-char			*dup_or_replace(char *entry, char *arg, char *key, int *flag);
+int				expand_to_builder(t_expand *exp, t_ms *ms, t_strbuf *sb);
 void			add_oldpwd_to_envp(t_ms *ms, char *pwd_before);
-int				rm_from_env_ex(char ***env, char *key, int flag);
 int				make_cd_args(char ***args, t_ms *ms, char *pwd_before);
 void			handle_updating_oldpwd(t_ms*ms, char *pwd_before);
+void			handle_hash(char **args, t_ms *ms);
+void			handle_parsecache(char **args, t_ms *ms);
+void			handle_jobs(char **args, t_ms *ms);
+void			handle_wait(char **args, t_ms *ms);
+void			handle_trace(char **args, t_ms *ms);
+void			handle_memstat(char **args, t_ms *ms);
 
 //Lexer
-t_token			*tokenization(char *str, t_ms *ms);
+int				tokenization(char *str, t_ms *ms);
+int				lex_error(t_lexer *lx);
+int				lex_word(t_lexer *lx);
+int				lex_redirect(t_lexer *lx);
+int				lex_pipe(t_lexer *lx);
+int				lex_control(t_lexer *lx);
+t_scan			lex_scanner(void);
+size_t			scan_scalar(const char *s, char quote, t_bool *dollar);
+size_t			scan_sse2(const char *s, char quote, t_bool *dollar);
+size_t			scan_avx2(const char *s, char quote, t_bool *dollar);
+int				finish_tokens(t_tokens *toks, t_ms *ms);
 t_type			define_token_type(char *str, size_t i);
-t_token			*create_new_token(char *str, size_t *i, t_type type, t_ms *ms);
-char			*word_with_quotes(char *str, size_t *start, t_token *new,
-					t_ms *ms);
-char			*word_without_quotes(char *str, size_t *start, t_ms *ms);
+t_token			*create_new_token(t_lexer *lx, t_type type);
+int				tokens_reserve(t_tokens *toks, size_t n);
+int				pcache_lookup(t_ms *ms, char *line);
+void			pcache_store(t_ms *ms, char *line);
+void			pcache_link(t_pcache *pc, t_parsed *entry);
+void			pcache_unlink(t_pcache *pc, t_parsed *entry);
+void			pcache_clear(t_pcache *pc);
 void			skip_special_tokens(char *str, size_t *i, t_type type);
-void			skip_whitespaces(char *str, size_t *i);
-void			clean_token(t_token *token);
 t_bool			is_empty_word_token(t_token *token);
-t_token			*clean_token_list(t_token **first);
-t_token			*delete_empty_word_tokens(t_token *first);
-t_token			*delete_whitespace_tokens(t_token *first);
-t_token			*unite_two_word_tokens(t_token *first, t_ms *ms);
+void			clean_token_list(t_tokens *toks);
 t_bool			is_redirect(t_type type);
-void			flags_for_redirections(t_token *cur);
-void			put_files_for_redirections(t_token *cur, t_ms *ms);
-int				check_list_for_tilde(t_token *first, t_ms *ms);
+void			process_redirection_file(t_token *redir, t_token *word);
+int				expand_tilde(t_token *cur, t_ms *ms);
 
 //Parser
 int				words_in_cmd_block(t_token *start, t_token *end);
-int				copy_single_word(t_cmd *cmd, const char *data, int *index, \
-				t_ms *ms);
+void			copy_single_word(t_cmd *cmd, char *data, int *index);
 int				copy_expanded_words(t_cmd *cmd, const char *data, int *index, \
 				t_ms *ms);
 int				put_cmg_args(t_cmd *cmd, t_token *start, t_token *end,
 					t_ms *ms);
 t_cmd			*create_new_cmd(t_block *block, int num, t_ms *ms);
 t_cmd			*create_cmd_list(t_block *block, t_ms *ms);
-t_cmd			*clean_cmd(t_cmd *cmd);
 t_cmd			*clean_cmd_list(t_cmd **first);
 int				check_block(t_token *start, t_token *end, int *err_flag);
-t_block			*create_block(t_ms *ms, t_token *start, t_token *end, \
+t_block			*create_block(t_ms *ms, size_t start, size_t end, \
 				t_block *first_block);
-t_block			*create_blocks_list(t_ms *ms, t_token *start, t_token *end);
+t_block			*create_blocks_list(t_ms *ms, t_tokens *toks);
 void			redir_in_block(t_block *block, t_cmd *cmd, t_ms *ms);
-t_block			*clean_block(t_block *block);
 t_block			*clean_block_list(t_block **first);
-char			*str_before_space(const char *str);
-char			*str_after_space(const char *str);
+t_node			*parse_list(t_ms *ms, t_tokens *toks);
+char			*list_text(t_ms *ms, t_node *item);
+size_t			parse_time(t_tokens *toks, size_t i, int *timed);
+char			*str_before_space(const char *str, t_ms *ms);
+char			*str_after_space(const char *str, t_ms *ms);
 int				has_multiple_words(const char *str);
 
 //Execution
@@ -129,17 +132,73 @@ void			handle_no_path_variable(char **envp, char **cmd, t_ms *ms);
 void			check_if_dot(char **cmds, t_ms *ms);
 void			setup_pipes(int *pipe_fd, int i, int num_cmds, int cur_fd);
 void			redirect_process(int infile, int outfile, t_ms *ms);
+char			*find_path_from_envp(char *cmd, t_ms *ms);
+char			*resolve_cmd_path(char *name, t_ms *ms);
+t_hash			*hash_get(t_ms *ms, char *name);
+t_hash			*hash_insert(t_ms *ms, char *name, char *path);
+void			hash_clear(t_ms *ms);
+pid_t			spawn_command(t_cmd *cur, t_cmd *cmds, t_pipe *p, t_ms *ms);
+int				run_inline_builtin(t_cmd *cur, t_pipe *p);
+int				defer_pump(t_cmd *cur, t_pipe *p);
+void			run_pump(t_pipe *p);
+int				pump_fd(int in, int out);
+int				pump_file(char *name, int in, int out);
+size_t			pipe_capacity(int fd);
+int				pipe_size_setting(t_ms *ms);
+int				open_pipe(t_pipe *p);
+t_child			*children_new(int n, t_ms *ms);
+void			child_watch(t_child *c, pid_t pid);
+void			children_release(t_child *kids, int n);
+void			reap_children(t_child *kids, int n);
+void			finish_children(t_child *kids, int n, t_ms *ms);
+void			finish_child(pid_t pid, t_ms *ms);
+void			record_pipestatus(t_child *kids, int n, t_ms *ms);
+int				run_pipeline(t_ms *ms, t_node *node);
+void			run_list(t_ms *ms);
+pid_t			start_process(t_cmd *cur, t_cmd *cmds, t_pipe *p, t_ms *ms);
+void			timer_start(t_ms *ms);
+void			timer_report(t_ms *ms, int format);
+int				children_poll(t_child *kids, int n);
+
+//Trace
+long long		trace_now(void);
+long long		trace_begin(t_ms *ms);
+void			trace_end(t_ms *ms, const char *name, long long start,
+					pid_t pid);
+void			trace_wait(t_ms *ms, long long start, t_child *kids, int n);
+void			trace_clear(t_trace *tr);
+void			trace_dump(t_ms *ms, int fd);
+
+//Jobs
+void			job_setpgid(t_ms *ms, pid_t pid);
+void			job_detach_stdin(t_cmd *cmds);
+void			job_add(t_ms *ms, t_child *kids, int n);
+void			job_add_pid(t_ms *ms, pid_t pid);
+void			job_init(t_job *job, t_ms *ms, t_child *kids, int n);
+void			job_remove(t_ms *ms, t_job *job);
+void			jobs_clear(t_ms *ms);
+t_job			*job_find(t_ms *ms, pid_t pid, int id);
+void			job_print(t_job *job, int running);
+void			jobs_notify(t_ms *ms);
 
 //Envp
-int				check_list_for_expansions(t_token *first, t_ms *ms);
-t_expand		*exp_init(t_ms *ms);
-t_expand		*initialize_expansion(t_ms *ms);
-int				expand_in_token(t_token *cur, t_ms *ms, t_bool first_in_str);
-void			expand_variable(t_ms *ms, t_expand *exp, char **result);
-char			*handle_spaces(char *copy, t_expand *exp);
+int				expand_variable(t_ms *ms, t_expand *exp, t_strbuf *sb);
+int				handle_spaces(t_strbuf *sb, const char *value, t_expand *exp,
+					t_ms *ms);
+t_var			*env_get(t_env *env, const char *key);
+int				env_insert(t_env *env, t_var *var);
+void			env_unset(t_env *env, const char *key);
+int				env_set(t_env *env, const char *key, const char *value);
+void			env_link_last(t_env *env, t_var *var);
+void			env_unlink(t_env *env, t_var *var);
+char			**env_snapshot(t_ms *ms);
+void			env_free(t_env *env);
+int				env_sorted_insert(t_env *env, t_var *var);
+void			env_sorted_remove(t_env *env, t_var *var);
 
 //Main
-t_ms			*initialize_struct(char **envp);
+t_ms			*initialize_struct(char **envp, t_reader *reader);
+t_reader		*script_reader(int argc, char **argv);
 void			initialize_envp_and_exp(t_ms *ms, char **envp);
 int				create_blocks_and_cmds_lists(t_ms *ms);
 int				tokenize_input(char **input, t_ms *ms);
@@ -149,22 +208,42 @@ void			checking_pwds(t_ms *ms);
 
 //Redirections
 void			redirect_process(int infile, int outfile, t_ms *ms);
-void			put_infile_fd(t_token *token, t_cmd *cmd);
+void			put_infile_fd(t_token *token, t_cmd *cmd, t_ms *ms);
 void			put_outfile_fd(t_token *token, t_cmd *cmd);
 void			check_access(char *filename, t_oper operation);
-char			*generate_filename(int index, t_ms *ms);
+int				heredoc_to_fd(t_strbuf *body, t_ms *ms);
 void			put_heredoc_fd(t_token *token, t_cmd *cmd, t_ms *ms);
-int				handle_heredoc(t_ms *ms, char *limiter, t_token *token);
+int				handle_heredoc(t_ms *ms, t_token *token);
+int				read_heredocs(t_ms *ms, t_tokens *toks);
+int				heredoc_register(t_ms *ms, int fd);
+void			release_infile(t_ms *ms, t_cmd *cmd);
 void			reset_heredocs(t_ms *ms);
+size_t			heredoc_ceiling(t_ms *ms);
 
 //Reading + history
 t_bool			open_read_history_file(t_ms *ms);
-void			write_to_history_file(t_ms *ms);
+void			compact_history_file(t_ms *ms);
+size_t			history_tail(const char *map, size_t size, size_t max);
+void			append_to_history_file(char *line, t_ms *ms);
 void			add_line_to_history(char *line, t_ms *ms);
-void			default_history(char **history);
+void			default_history(t_history *h);
+size_t			history_hash(const char *line);
+int				history_index_insert(t_history *h, t_hent *e);
+void			history_index_remove(t_history *h, t_hent *e);
+t_hent			*history_find(t_history *h, const char *line);
+void			history_erase(t_history *h, t_hent *e);
+void			history_trim(t_history *h);
+int				history_push(t_history *h, const char *line);
+int				history_settings(t_ms *ms);
+int				history_skip_line(char *line, int flags, t_history *h);
 void			fill_ms_history_line(char *line, t_ms *ms);
 void			clean_ms_history(t_ms *ms);
 void			history_exit(t_ms *ms);
+t_reader		*reader_init(int fd);
+char			*reader_next_line(t_reader *reader, t_ms *ms);
+void			reader_free(t_reader **reader);
+char			*read_input_line(t_ms *ms);
+char			*read_heredoc_line(t_ms *ms);
 
 //Signals
 void			signal_mode(t_mode mode);
@@ -184,11 +263,32 @@ void			print_env_error(char **args);
 void			print_flag_error(char **args);
 void			*print_malloc_set_status(t_ms *ms);
 
+//Memory
+void			*arena_alloc(t_ms *ms, size_t size);
+void			arena_reset(t_arena *arena);
+void			arena_free(t_arena *arena);
+void			arena_report(t_arena *arena);
+char			*arena_strndup(t_ms *ms, const char *s, size_t n);
+char			*arena_strdup(t_ms *ms, const char *s);
+char			*arena_strjoin(t_ms *ms, const char *s1, const char *s2);
+int				sb_init(t_strbuf *sb, size_t hint, t_ms *ms);
+int				sb_append(t_strbuf *sb, const char *s, size_t n, t_ms *ms);
+int				sb_putc(t_strbuf *sb, char c, t_ms *ms);
+void			sb_free(t_strbuf *sb);
+t_memstat		*memstat_state(void);
+void			*memstat_keep(void *ptr, const char *file, int line);
+void			*memstat_malloc(size_t size, const char *file, int line);
+void			memstat_forget(t_memstat *st, void *ptr);
+void			memstat_free(void *ptr);
+char			**memstat_split(char **arr, const char *file, int line);
+void			memstat_release(void);
+void			memstat_dump(int fd, int sites);
+void			memstat_exit(void);
+
 //Cleaners
 void			clean_arr(char ***arr);
 void			clean_struct(t_ms *ms);
 void			clean_struct_partially(t_ms *ms);
-void			cleanup_heredocs(char **filenames, t_ms *ms);
 void			clean_in_child(t_ms *ms);
 void			free_pids(t_pipe *p);
 void			close_every_cmds_fds(t_cmd *cmd);
@@ -196,4 +296,6 @@ void			close_pipe_fds(t_pipe *p);
 void			close_file(int file);
 void			close_two_fds(int fd1, int fd2);
 
+# include "memstat.h"
+
 #endif
@@ -6,26 +6,67 @@
 /*   By: ssalorin <ssalorin@student.hive.fi>        +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/03/27 12:43:51 by ssalorin          #+#    #+#             */
-/*   Updated: 2025/03/27 12:43:52 by ssalorin         ###   ########.fr       */
+/*   Updated: 2026/10/17 03:16:31 by agent            ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #ifndef STRUCTS_H
 # define STRUCTS_H
 
-typedef struct s_token
+typedef size_t	(*t_scan)(const char *s, char quote, t_bool *dollar);
+
+typedef struct s_seg
 {
-	t_type			type;
-	char			*data;
-	char			*file;
+	char			*start;
+	size_t			len;
 	t_char			quote;
-	t_bool			unclosed;
-	t_type			specific_redir;
-	t_bool			ambiguous;
-	t_bool			expanded;
-	struct s_token	*next;
+	t_bool			dollar;
+	struct s_seg	*next;
+}	t_seg;
+
+typedef struct s_token
+{
+	t_type	type;
+	char	*data;
+	char	*file;
+	t_char	quote;
+	t_seg	*segs;
+	char	*body;
+	t_type	specific_redir;
+	t_bool	ambiguous;
+	t_bool	expanded;
+	size_t	pos;
 }	t_token;
 
+typedef struct s_tokens
+{
+	t_token	*arr;
+	size_t	len;
+	size_t	cap;
+}	t_tokens;
+
+typedef struct s_parsed
+{
+	char			*line;
+	size_t			hash;
+	t_token			*toks;
+	size_t			ntoks;
+	struct s_parsed	*newer;
+	struct s_parsed	*older;
+	struct s_parsed	*hnext;
+}	t_parsed;
+
+typedef struct s_pcache
+{
+	t_parsed	*buckets[PCACHE_BUCKETS];
+	t_parsed	*newest;
+	t_parsed	*oldest;
+	size_t		count;
+	size_t		hits;
+	size_t		misses;
+	t_bool		drop;
+}	t_pcache;
+
 typedef struct s_cmd
 {
 	char			*name;
@@ -33,33 +74,252 @@ typedef struct s_cmd
 	int				num;
 	int				infile;
 	int				outfile;
+	t_bool			heredoc;
 	struct s_cmd	*next;
 }	t_cmd;
 
 typedef struct s_block
 {
-	t_token			*start;
-	t_token			*end;
+	size_t			start;
+	size_t			end;
 	struct s_block	*next;
 }	t_block;
 
+typedef struct s_chunk
+{
+	char			*data;
+	size_t			size;
+	size_t			used;
+	struct s_chunk	*next;
+}	t_chunk;
+
+typedef struct s_arena
+{
+	t_chunk	*head;
+	t_chunk	*cur;
+	size_t	allocs;
+	size_t	chunks;
+	size_t	resets;
+}	t_arena;
+
+typedef struct s_strbuf
+{
+	char	*buf;
+	size_t	len;
+	size_t	cap;
+}	t_strbuf;
+
+typedef struct s_lexer
+{
+	char		*str;
+	size_t		i;
+	t_token		*word;
+	t_seg		*seg;
+	t_type		redir;
+	t_bool		cmd_empty;
+	t_bool		after_quote;
+	t_bool		redir_chain;
+	char		*err;
+	struct s_ms	*ms;
+}	t_lexer;
+
+typedef struct s_hent
+{
+	char			*line;
+	size_t			hash;
+	size_t			seq;
+	struct s_hent	*hnext;
+}	t_hent;
+
+typedef struct s_history
+{
+	t_hent	**ring;
+	size_t	cap;
+	size_t	first;
+	size_t	end;
+	size_t	live;
+	size_t	max;
+	t_hent	**buckets;
+	size_t	size;
+}	t_history;
+
+typedef struct s_heredocs
+{
+	int		*fds;
+	size_t	count;
+	size_t	cap;
+}	t_heredocs;
+
+typedef struct s_hash
+{
+	char			*name;
+	char			*path;
+	int				hits;
+	struct s_hash	*next;
+}	t_hash;
+
+typedef struct s_reader
+{
+	int		fd;
+	char	*buf;
+	size_t	cap;
+	size_t	start;
+	size_t	end;
+	t_bool	eof;
+}	t_reader;
+
+typedef struct s_var
+{
+	char			*entry;
+	char			*value;
+	size_t			klen;
+	struct s_var	*hnext;
+	struct s_var	*prev;
+	struct s_var	*next;
+}	t_var;
+
+typedef struct s_env
+{
+	t_var	**buckets;
+	size_t	size;
+	size_t	count;
+	t_var	*first;
+	t_var	*last;
+	t_var	**sorted;
+	size_t	sorted_cap;
+	char	**snapshot;
+	t_bool	dirty;
+}	t_env;
+
+typedef struct s_child
+{
+	pid_t			pid;
+	int				pidfd;
+	int				status;
+	int				signal;
+	t_bool			done;
+	long long		reaped;
+	struct rusage	usage;
+}	t_child;
+
+typedef struct s_job
+{
+	int				id;
+	pid_t			pgid;
+	char			*line;
+	t_child			*kids;
+	int				n;
+	struct s_job	*next;
+}	t_job;
+
+typedef struct s_jobs
+{
+	t_job	*first;
+	t_bool	background;
+	pid_t	pgid;
+	pid_t	last_pid;
+	char	*line;
+}	t_jobs;
+
+typedef struct s_node
+{
+	t_type			op;
+	size_t			start;
+	size_t			end;
+	int				timed;
+	struct s_node	*body;
+	struct s_node	*next;
+}	t_node;
+
+typedef struct s_line
+{
+	char		*text;
+	t_tokens	toks;
+	t_node		*list;
+}	t_line;
+
+typedef struct s_event
+{
+	const char	*name;
+	pid_t		pid;
+	long long	start;
+	long long	end;
+}	t_event;
+
+typedef struct s_trace
+{
+	t_bool	on;
+	t_event	*events;
+	size_t	len;
+	size_t	cap;
+	size_t	dropped;
+}	t_trace;
+
+typedef struct s_timer
+{
+	long long		start;
+	struct rusage	self;
+	long long		user;
+	long long		sys;
+}	t_timer;
+
+typedef struct s_site
+{
+	const char	*file;
+	int			line;
+	t_memsub	sub;
+	size_t		allocs;
+	size_t		bytes;
+	size_t		live;
+}	t_site;
+
+typedef struct s_mblock
+{
+	void			*ptr;
+	size_t			size;
+	t_site			*site;
+	struct s_mblock	*next;
+}	t_mblock;
+
+typedef struct s_memstat
+{
+	t_site		sites[MEMSTAT_SITES];
+	int			slots[MEMSTAT_SLOTS];
+	int			nsites;
+	t_mblock	*blocks[MEMSTAT_BUCKETS];
+	size_t		live[SUB_COUNT + 1];
+	size_t		peak[SUB_COUNT + 1];
+	pid_t		pid;
+}	t_memstat;
+
 typedef struct s_ms
 {
-	int		exit_status;
-	char	**envp;
-	char	**exported;
-	t_token	*tokens;
-	t_block	*blocks;
-	t_cmd	*cmds;
-	t_bool	history_file;
-	char	*history[500];
-	int		history_num;
-	char	**heredoc_files;
-	int		heredoc_count;
-	int		no_env;
-	char	*pwd;
-	int		err;
-	int		unset_pwd_exp_old;
+	int			exit_status;
+	t_env		env;
+	t_tokens	tokens;
+	t_scan		scan;
+	t_pcache	pcache;
+	t_block		*blocks;
+	t_cmd		*cmds;
+	t_bool		history_file;
+	t_history	hist;
+	int			history_fd;
+	size_t		history_lines;
+	char		*history_path;
+	int			no_env;
+	char		*pwd;
+	int			err;
+	int			unset_pwd_exp_old;
+	t_reader	*reader;
+	t_bool		script_mode;
+	t_hash		*cmd_hash[HASH_SIZE];
+	t_arena		arena;
+	t_heredocs	heredocs;
+	t_strbuf	pipestatus;
+	t_jobs		jobs;
+	t_line		line;
+	t_trace		trace;
+	t_timer		timer;
 }	t_ms;
 
 typedef struct s_expand
@@ -79,15 +339,24 @@ typedef struct s_envp
 	struct s_envp	*next;
 }	t_envp;
 
+typedef struct s_pump
+{
+	t_cmd	*cmd;
+	int		stage;
+	int		in;
+	int		out;
+}	t_pump;
+
 typedef struct s_pipe
 {
 	int		num_cmds;
 	int		cmd_num;
 	int		fd[2];
 	int		cur_fd;
-	pid_t	last_pid;
-	pid_t	*pids;
+	t_child	*stages;
+	int		pipe_size;
 	t_ms	*ms;
+	t_pump	pump;
 }	t_pipe;
 
 #endif
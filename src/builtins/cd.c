@@ -6,7 +6,7 @@
 /*   By: ssalorin <ssalorin@student.hive.fi>        +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/03/27 12:55:20 by ssalorin          #+#    #+#             */
-/*   Updated: 2025/03/27 12:55:22 by ssalorin         ###   ########.fr       */
+/*   Updated: 2026/10/17 01:18:03 by agent            ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -17,7 +17,7 @@
  *
  * This function updates `PWD` and `OLDPWD` in the shell's environment:
  * - Retrieves the current working directory using `getcwd()`.
- * - If `OLDPWD` does not exist in `envp`, it adds it using 
+ * - If `OLDPWD` has no value yet, it adds one using 
  *   `add_oldpwd_to_envp()`.
  * - Calls `handle_updating_oldpwd()` to properly set `OLDPWD`.
  * - Updates `PWD` with the new directory path if no memory allocation 
@@ -38,11 +38,11 @@ static void	update_cd_env(t_ms *ms, char *pwd_before)
 		return ;
 	}
 	if (ms->exit_status != MALLOC_ERR
-		&& !get_env_value("OLDPWD", ms->envp))
+		&& !get_env_value("OLDPWD", ms))
 		add_oldpwd_to_envp(ms, pwd_before);
 	handle_updating_oldpwd(ms, pwd_before);
 	if (ms->exit_status != MALLOC_ERR)
-		update_env_var(ms, "PWD=", cwd);
+		update_env_var(ms, "PWD", cwd);
 }
 
 /**
@@ -6,7 +6,7 @@
 /*   By: ssalorin <ssalorin@student.hive.fi>        +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/03/27 12:55:13 by ssalorin          #+#    #+#             */
-/*   Updated: 2025/03/27 12:55:15 by ssalorin         ###   ########.fr       */
+/*   Updated: 2026/10/17 01:18:03 by agent            ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -19,8 +19,7 @@
  * directories.
  * - If `PWD` exists, `OLDPWD` is set to its value.
  * - If `PWD` was unset and `unset_pwd_exp_old` is true, `OLDPWD` is 
- *   removed from both `envp` and `exported` and then re-added to 
- *   `exported`.
+ *   removed and then exported again without a value.
  * - Otherwise, `OLDPWD` is set to `pwd_before`.
  *
  * @param ms A pointer to the main shell structure containing 
@@ -31,20 +30,17 @@ void	handle_updating_oldpwd(t_ms*ms, char *pwd_before)
 {
 	char	*current_pwd;
 
-	current_pwd = get_env_value("PWD", ms->envp);
+	current_pwd = get_env_value("PWD", ms);
 	if (current_pwd)
-		update_env_var(ms, "OLDPWD=", current_pwd);
+		update_env_var(ms, "OLDPWD", current_pwd);
 	else if (ms->unset_pwd_exp_old == true)
 	{
-		if (!rm_from_env_ex(&ms->exported, "OLDPWD", 1)
-			|| !rm_from_env_ex(&ms->envp, "OLDPWD", 0))
-			print_malloc_set_status(ms);
-		if (ms->exit_status != MALLOC_ERR)
-			add_to_exported("OLDPWD", ms);
+		env_unset(&ms->env, "OLDPWD");
+		add_to_exported("OLDPWD", ms);
 		ms->unset_pwd_exp_old = false;
 	}
 	else
-		update_env_var(ms, "OLDPWD=", pwd_before);
+		update_env_var(ms, "OLDPWD", pwd_before);
 }
 
 /**
@@ -68,7 +64,7 @@ static void	handle_empty_oldpwd(t_ms *ms)
 	char	cwd[1024];
 
 	ft_putstr_fd("\n", STDOUT_FILENO);
-	current_pwd = get_env_value("PWD", ms->envp);
+	current_pwd = get_env_value("PWD", ms);
 	if (!current_pwd || *current_pwd == '\0')
 	{
 		if (getcwd(cwd, sizeof(cwd)) == NULL)
@@ -77,10 +73,10 @@ static void	handle_empty_oldpwd(t_ms *ms)
 			ms->exit_status = 1;
 			return ;
 		}
-		update_env_var(ms, "PWD=", cwd);
+		update_env_var(ms, "PWD", cwd);
 		return ;
 	}
-	update_env_var(ms, "OLDPWD=", current_pwd);
+	update_env_var(ms, "OLDPWD", current_pwd);
 	return ;
 }
 
@@ -103,7 +99,7 @@ static void	handle_empty_oldpwd(t_ms *ms)
  * to the previous directory using `cd -`.
  * 
  * @param ms The main shell structure, containing the environment variables 
- *           `envp` and exit status.
+ *           environment store and exit status.
  * 
  * @return Returns a newly allocated string containing the `OLDPWD` 
  *         directory, or `NULL` if any error occurs.
@@ -112,7 +108,7 @@ char	*get_oldpwd_directory(t_ms *ms)
 {
 	char	*target;
 
-	target = get_env_value("OLDPWD", ms->envp);
+	target = get_env_value("OLDPWD", ms);
 	if (!target)
 	{
 		ft_putstr_fd("cd: OLDPWD not set\n", STDERR_FILENO);
@@ -167,46 +163,25 @@ static void	export_oldpwd(t_ms *ms, char *pwd_before)
 }
 
 /**
- * @brief Adds the previous working directory (`OLDPWD`) to `envp` if it 
- * does not already exist.
+ * @brief Gives `OLDPWD` a value if it is exported without one.
  * 
- * This function checks if the `OLDPWD` variable exists in the `exported` 
- * environment. If `OLDPWD` is found in the `exported` array, the function 
- * proceeds to search for it in the `envp` array. If `OLDPWD` is not found 
- * in the `envp` array, it calls `make_cd_args` to add it, using the 
- * `pwd_before` argument as the value of `OLDPWD`.
+ * This function checks if the `OLDPWD` variable exists in the environment 
+ * store. If it does but has no value, it calls `make_cd_args` to export it, 
+ * using the `pwd_before` argument as the value of `OLDPWD`.
  * 
  * The `OLDPWD` environment variable stores the previous working directory, 
  * which is updated during `cd` commands to allow users to return to the 
  * last directory they were in.
  * 
- * @param ms The main shell structure, containing both `envp` and 
- *           `exported` environment variables.
+ * @param ms The main shell structure, containing the environment store.
  * @param pwd_before The path to the directory before a `cd` command is 
  *                   executed (used as the `OLDPWD` value).
  */
 void	add_oldpwd_to_envp(t_ms *ms, char *pwd_before)
 {
-	int		check;
-	int		i;
+	t_var	*var;
 
-	i = 0;
-	check = 0;
-	while (ms->exported[i])
-	{
-		if (!ft_strncmp("OLDPWD", ms->exported[i], 6))
-			check = 1;
-		i++;
-	}
-	if (check == 0)
-		return ;
-	i = 0;
-	while (ms->envp[i])
-	{
-		if (!ft_strncmp("OLDPWD", ms->envp[i], 6))
-			check = 0;
-		i++;
-	}
-	if (check == 1)
+	var = env_get(&ms->env, "OLDPWD");
+	if (var && !var->value)
 		export_oldpwd(ms, pwd_before);
 }
@@ -6,7 +6,7 @@
 /*   By: ssalorin <ssalorin@student.hive.fi>        +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/03/27 12:55:35 by ssalorin          #+#    #+#             */
-/*   Updated: 2025/03/27 12:55:38 by ssalorin         ###   ########.fr       */
+/*   Updated: 2026/10/17 01:18:03 by agent            ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -17,8 +17,9 @@
  *        environment variables.
  * 
  * If the `env` command is called without arguments, it prints all environment 
- * variables stored in `ms->envp`. If any arguments are passed (other than 
- * `env`), an error message is printed and the exit status is set to 127.
+ * variables that have a value, in the order they were set. If any arguments 
+ * are passed (other than `env`), an error message is printed and the exit 
+ * status is set to 127.
  * 
  * @param args The arguments passed to the `env` command. The first argument 
  *             should be "env".
@@ -27,6 +28,8 @@
  */
 void	handle_env(char	**args, t_ms *ms)
 {
+	char	**envp;
+
 	ms->exit_status = 0;
 	if (args[1])
 	{
@@ -34,5 +37,7 @@ void	handle_env(char	**args, t_ms *ms)
 		ms->exit_status = 127;
 		return ;
 	}
-	print_array(ms->envp);
+	envp = env_snapshot(ms);
+	if (envp)
+		print_array(envp);
 }
@@ -6,7 +6,7 @@
 /*   By: ssalorin <ssalorin@student.hive.fi>        +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/03/27 12:55:53 by ssalorin          #+#    #+#             */
-/*   Updated: 2025/03/27 12:55:55 by ssalorin         ###   ########.fr       */
+/*   Updated: 2026/10/17 02:44:16 by agent            ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -31,7 +31,9 @@ static void	clean_up_and_exit(int exit_status, t_ms *ms)
 {
 	clean_cmd_list(&(ms->cmds));
 	history_exit(ms);
+	arena_report(&ms->arena);
 	clean_struct(ms);
+	memstat_exit();
 	exit(exit_status);
 }
 
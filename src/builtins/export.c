@@ -6,109 +6,17 @@
 /*   By: ssalorin <ssalorin@student.hive.fi>        +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/03/27 12:56:06 by ssalorin          #+#    #+#             */
-/*   Updated: 2025/03/27 12:56:08 by ssalorin         ###   ########.fr       */
+/*   Updated: 2026/10/17 01:19:07 by agent            ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "../../include/minishell.h"
 
 /**
- * @brief Creates a temporary copy of the environment array, updating or 
- *        preserving entries.
- *
- * This function allocates a new environment array with extra space for 
- * potential additions. It copies existing variables while replacing the 
- * value of the given key if necessary. If memory allocation fails, the 
- * function cleans up and returns NULL.
- *
- * @param arg The full "KEY=VALUE" string to be added or updated.
- * @param env A pointer to the environment/exported variable array.
- * @param key The key extracted from the argument to identify the variable.
- * @param flag A pointer indicating whether the key exists (1 if updated, 
- *             0 if new).
- *
- * @return A newly allocated environment array with the updated values or 
- *         NULL on failure.
- */
-static char	**copy_to_temp(char *arg, char ***env, char *key, int *flag)
-{
-	char	**temp;
-	int		i;
-
-	i = 0;
-	temp = allocate_temp_env(*env, 2);
-	if (!temp)
-		return (NULL);
-	while ((*env)[i])
-	{
-		temp[i] = dup_or_replace((*env)[i], arg, key, flag);
-		if (!temp[i])
-		{
-			clean_arr(&temp);
-			return (NULL);
-		}
-		i++;
-	}
-	temp[i] = NULL;
-	return (temp);
-}
-
-/**
- * @brief Changes the value of an environment variable in the specified 
- *        environment array.
- * 
- * This function updates the environment variable specified by `key` with 
- * the value provided in `arg`. If the flag is not 2, it appends the new 
- * value to the environment array. The environment array (`env`) is 
- * dynamically resized to accommodate the new value. The function handles 
- * memory allocation for the new environment array and frees the old one. 
- * If any memory allocation fails, the function cleans up and returns `0`, 
- * signaling an error.
- * 
- * @param arg The new environment variable value (in the form of a string).
- * @param env A pointer to the environment array (`env`), which will be 
- *            updated.
- * @param key The key of the environment variable to be modified.
- * @param flag A flag indicating whether the value should be added (1), or 
- *             replaced (2). If the flag is not 2, the value is appended.
- * 
- * @return Returns `1` on success, or `0` if an error occurred (such as 
- *         memory allocation failure).
- */
-static int	change_values(char *arg, char ***env, char *key, int flag)
-{
-	char	**temp;
-	int		i;
-
-	i = 0;
-	temp = copy_to_temp(arg, env, key, &flag);
-	if (!temp || !*temp)
-		return (0);
-	if (flag != 2)
-	{
-		while (temp[i])
-			i++;
-		temp[i] = ft_strdup(arg);
-		if (!temp[i])
-		{
-			clean_arr(&temp);
-			return (0);
-		}
-		i++;
-		temp[i] = NULL;
-	}
-	clean_arr(env);
-	*env = temp;
-	return (1);
-}
-
-/**
- * @brief Changes environment variable values in both `exported` 
- * and `envp` arrays.
+ * @brief Sets an environment variable from a `KEY=value` argument.
  * 
  * This function extracts the key from the given argument, checks if the key is 
- * valid, and updates the corresponding environment variable in both `exported` 
- * and `envp` arrays using the `change_values` function. If the key is invalid, 
+ * valid, and stores the value in the environment store. If the key is invalid, 
  * an error is printed, and the function returns without modifying 
  * the environment. If any memory allocation fails, the shell's exit status is 
  * set to `MALLOC_ERR`, and the function ensures that memory is freed before
@@ -138,13 +46,10 @@ void	change_values_env_ex(char *arg, t_ms *ms)
 		print_export_error(ms, arg);
 		return ;
 	}
-	if (!change_values(arg, &ms->exported, key, 1)
-		|| !change_values(arg, &ms->envp, key, 0))
-	{
+	if (!env_set(&ms->env, key, arg + len + 1))
 		print_malloc_set_status(ms);
-		free(key);
-		return ;
-	}
+	else if (ft_strcmp(key, "PATH") == 0)
+		hash_clear(ms);
 	free(key);
 }
 
@@ -160,7 +65,6 @@ void	change_values_env_ex(char *arg, t_ms *ms)
  *   environment.
  * - Otherwise, it adds the variable to the list of exported names without 
  *   assigning a value.
- * - After each modification, the exported variables are sorted alphabetically.
  *
  * @param args A null-terminated array of arguments passed to `export`.
  * @param ms A pointer to the shell's main structure containing environment 
@@ -185,7 +89,6 @@ static void	process_arguments(char **args, t_ms *ms)
 			add_to_exported(args[i], ms);
 		if (ms->exit_status == MALLOC_ERR)
 			return ;
-		sort_exported_alphaorder(ms);
 		i++;
 	}
 }
@@ -196,7 +99,7 @@ static void	process_arguments(char **args, t_ms *ms)
  * 
  * This function checks the number of arguments passed to the `export` command:
  * - If there is only one argument (i.e., `export` with no variable), it 
- *   sorts and prints the list of exported variables in alphabetical order.
+ *   prints the list of exported variables in alphabetical order.
  * - If the argument is `export _`, the function returns early without 
  *   making any changes.
  * - For other cases, it processes the arguments by calling 
@@ -217,7 +120,6 @@ void	handle_export(char **args, t_ms *ms)
 		arg_count++;
 	if (arg_count == 1)
 	{
-		sort_exported_alphaorder(ms);
 		print_exported(ms);
 		return ;
 	}
@@ -6,7 +6,7 @@
 /*   By: ssalorin <ssalorin@student.hive.fi>        +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/03/27 12:56:19 by ssalorin          #+#    #+#             */
-/*   Updated: 2025/03/27 12:56:21 by ssalorin         ###   ########.fr       */
+/*   Updated: 2026/10/17 01:19:07 by agent            ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -55,24 +55,23 @@ static void	print_var(char *var)
 /**
  * @brief Prints all exported environment variables in a specific format.
  *
- * This function iterates over the list of exported environment variables in 
- * the `ms->exported` array and prints each one using the `declare -x` format, 
- * followed by the variable name and value (with the value enclosed in quotes). 
- * For each exported variable, the function calls `print_var` to handle the 
- * printing of the variable name and value.
+ * This function walks the alphabetically sorted index of the environment 
+ * store and prints each variable using the `declare -x` format, followed by 
+ * the variable name and value (with the value enclosed in quotes). For each 
+ * exported variable, the function calls `print_var` to handle the printing 
+ * of the variable name and value.
  *
- * @param ms The shell's main structure containing the list of exported 
- *           environment variables.
+ * @param ms The shell's main structure containing the environment store.
  */
 void	print_exported(t_ms *ms)
 {
-	int		i;
+	size_t	i;
 
 	i = 0;
-	while (ms->exported[i])
+	while (i < ms->env.count)
 	{
 		ft_putstr_fd("declare -x ", STDOUT_FILENO);
-		print_var(ms->exported[i]);
+		print_var(ms->env.sorted[i]->entry);
 		ft_putchar_fd('\n', STDOUT_FILENO);
 		i++;
 	}
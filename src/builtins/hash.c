@@ -0,0 +1,143 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   hash.c                                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: agent <agent@local>                        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 01:05:11 by agent             #+#    #+#             */
+/*   Updated: 2026/10/17 01:18:03 by agent            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../include/minishell.h"
+
+/**
+ * @brief Prints one remembered command as a right-aligned hit count 
+ *        followed by its path.
+ * 
+ * @param entry The table entry to print.
+ */
+static void	print_hash_entry(t_hash *entry)
+{
+	int	digits;
+	int	n;
+
+	digits = 1;
+	n = entry->hits;
+	while (n >= 10)
+	{
+		n /= 10;
+		digits++;
+	}
+	while (digits++ < 4)
+		ft_putchar_fd(' ', STDOUT_FILENO);
+	ft_putnbr_fd(entry->hits, STDOUT_FILENO);
+	ft_putchar_fd('\t', STDOUT_FILENO);
+	ft_putstr_fd(entry->path, STDOUT_FILENO);
+	ft_putchar_fd('\n', STDOUT_FILENO);
+}
+
+/**
+ * @brief Prints the remembered command locations with their hit counts.
+ * 
+ * The output follows the format of bash: a `hits command` header followed 
+ * by one line per hashed command.
+ * 
+ * @param ms A pointer to the shell structure holding the table.
+ */
+static void	print_hash_table(t_ms *ms)
+{
+	t_hash	*entry;
+	int		i;
+	t_bool	empty;
+
+	i = -1;
+	empty = true;
+	while (++i < HASH_SIZE)
+	{
+		entry = ms->cmd_hash[i];
+		while (entry)
+		{
+			if (empty)
+				ft_putstr_fd("hits\tcommand\n", STDOUT_FILENO);
+			empty = false;
+			print_hash_entry(entry);
+			entry = entry->next;
+		}
+	}
+	if (empty)
+		ft_putstr_fd(HASH_EMPTY, STDOUT_FILENO);
+}
+
+/**
+ * @brief Searches `PATH` for a command and remembers where it was found.
+ * 
+ * Builtins are skipped like in bash. A command that cannot be found is 
+ * reported and sets the exit status to 1.
+ * 
+ * @param name The command name given to `hash`.
+ * @param ms A pointer to the shell structure holding the table.
+ */
+static void	hash_one_name(char *name, t_ms *ms)
+{
+	t_cmd	tmp;
+	char	*path;
+
+	tmp.name = name;
+	if (ft_strchr(name, '/') || is_builtin(&tmp))
+		return ;
+	path = NULL;
+	if (get_env_value("PATH", ms))
+		path = find_path_from_envp(name, ms);
+	if (ms->exit_status == MALLOC_ERR)
+		return ;
+	if (!path)
+	{
+		ft_putstr_fd(OWN_ERR_MSG, STDERR_FILENO);
+		ft_putstr_fd("hash: ", STDERR_FILENO);
+		ft_putstr_fd(name, STDERR_FILENO);
+		ft_putstr_fd(HASH_NF_ERR, STDERR_FILENO);
+		ms->exit_status = 1;
+		return ;
+	}
+	if (!hash_insert(ms, name, path))
+		print_malloc_set_status(ms);
+	free(path);
+}
+
+/**
+ * @brief Handles the `hash` builtin.
+ * 
+ * Without arguments the remembered command locations are listed. `-r` 
+ * forgets every location, and any names given are searched for in `PATH` 
+ * and remembered. Other flags are not supported.
+ * 
+ * @param args The arguments passed to the `hash` command.
+ * @param ms A pointer to the shell structure holding the table.
+ */
+void	handle_hash(char **args, t_ms *ms)
+{
+	int	i;
+
+	i = 1;
+	ms->exit_status = 0;
+	if (!args[1])
+	{
+		print_hash_table(ms);
+		return ;
+	}
+	if (ft_strcmp(args[1], "-r") == 0)
+	{
+		hash_clear(ms);
+		i++;
+	}
+	else if (args[1][0] == '-')
+	{
+		print_flag_error(args);
+		ms->exit_status = 2;
+		return ;
+	}
+	while (args[i] && ms->exit_status != MALLOC_ERR)
+		hash_one_name(args[i++], ms);
+}
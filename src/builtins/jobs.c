@@ -0,0 +1,49 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   jobs.c                                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: agent <agent@local>                        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 02:17:15 by agent             #+#    #+#             */
+/*   Updated: 2026/10/17 02:17:15 by agent            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../include/minishell.h"
+
+/**
+ * @brief Handles the `jobs` builtin.
+ * 
+ * Prints every background job with its state. Jobs reported as finished 
+ * are removed from the table, so each one is reported once. Options are 
+ * not supported: any argument prints the usage and fails with status 2.
+ * 
+ * @param args The arguments passed to the `jobs` command.
+ * @param ms A pointer to the shell structure holding the job table.
+ */
+void	handle_jobs(char **args, t_ms *ms)
+{
+	t_job	*job;
+	t_job	*next;
+	int		running;
+
+	ms->exit_status = 0;
+	if (args[1])
+	{
+		ft_putstr_fd(OWN_ERR_MSG, STDERR_FILENO);
+		ft_putstr_fd(JOBS_USAGE, STDERR_FILENO);
+		ms->exit_status = 2;
+		return ;
+	}
+	job = ms->jobs.first;
+	while (job)
+	{
+		next = job->next;
+		running = children_poll(job->kids, job->n);
+		job_print(job, running);
+		if (!running)
+			job_remove(ms, job);
+		job = next;
+	}
+}
@@ -0,0 +1,45 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   memstat.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: agent <agent@local>                        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 02:44:16 by agent             #+#    #+#             */
+/*   Updated: 2026/10/17 02:44:16 by agent            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../include/minishell.h"
+
+/**
+ * @brief Handles the `memstat` builtin.
+ * 
+ * Prints the allocation accounting of the shell: live and peak bytes per 
+ * subsystem, and with `-s` the allocations of every call site. It only 
+ * works in a build made with `MEMSTAT=1`; otherwise it fails with status 1. 
+ * Anything else prints the usage and fails with status 2.
+ * 
+ * @param args The arguments passed to the `memstat` command.
+ * @param ms A pointer to the shell structure, used for the exit status.
+ */
+void	handle_memstat(char **args, t_ms *ms)
+{
+	ms->exit_status = 0;
+	if (args[1] && (ft_strcmp(args[1], "-s") != 0 || args[2]))
+	{
+		ft_putstr_fd(OWN_ERR_MSG, STDERR_FILENO);
+		ft_putstr_fd(MEMSTAT_USAGE, STDERR_FILENO);
+		ms->exit_status = 2;
+	}
+	else if (!MEMSTAT_ON)
+	{
+		ft_putstr_fd(OWN_ERR_MSG, STDERR_FILENO);
+		ft_putstr_fd(MEMSTAT_OFF_ERR, STDERR_FILENO);
+		ms->exit_status = 1;
+	}
+	else if (!args[1])
+		memstat_dump(STDOUT_FILENO, MEMSTAT_NO_SITES);
+	else
+		memstat_dump(STDOUT_FILENO, MEMSTAT_ALL_SITES);
+}
@@ -0,0 +1,60 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   parsecache.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: agent <agent@local>                        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 02:04:19 by agent             #+#    #+#             */
+/*   Updated: 2026/10/17 02:24:25 by agent            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../include/minishell.h"
+
+/**
+ * @brief Prints one counter followed by a separator.
+ * 
+ * @param n The counter.
+ * @param sep The string printed after it.
+ */
+static void	print_counter(size_t n, char *sep)
+{
+	ft_putnbr_fd((int)n, STDOUT_FILENO);
+	ft_putstr_fd(sep, STDOUT_FILENO);
+}
+
+/**
+ * @brief Handles the `parsecache` builtin.
+ * 
+ * Without arguments the parse cache's hits, misses and the number of lines it 
+ * holds are printed. `-r` resets the counters and empties the cache once the 
+ * current command line is done, as its tokens may still be in use. Anything 
+ * else prints the usage and fails with status 2.
+ * 
+ * @param args The arguments passed to the `parsecache` command.
+ * @param ms A pointer to the shell structure holding the cache.
+ */
+void	handle_parsecache(char **args, t_ms *ms)
+{
+	ms->exit_status = 0;
+	if (!args[1])
+	{
+		ft_putstr_fd("hits\tmisses\tlines\n", STDOUT_FILENO);
+		print_counter(ms->pcache.hits, "\t");
+		print_counter(ms->pcache.misses, "\t");
+		print_counter(ms->pcache.count, "\n");
+	}
+	else if (ft_strcmp(args[1], "-r") == 0 && !args[2])
+	{
+		ms->pcache.drop = true;
+		ms->pcache.hits = 0;
+		ms->pcache.misses = 0;
+	}
+	else
+	{
+		ft_putstr_fd(OWN_ERR_MSG, STDERR_FILENO);
+		ft_putstr_fd(PCACHE_USAGE, STDERR_FILENO);
+		ms->exit_status = 2;
+	}
+}
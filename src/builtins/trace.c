@@ -0,0 +1,44 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   trace.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: agent <agent@local>                        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 02:31:20 by agent             #+#    #+#             */
+/*   Updated: 2026/10/17 02:31:20 by agent            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../include/minishell.h"
+
+/**
+ * @brief Handles the `trace` builtin.
+ * 
+ * `trace on` starts recording monotonic timestamps for the front-end 
+ * phases of each line (read, process, tokenize, expand, build, exec) and 
+ * for the spawn and wait of every stage; `trace off` stops it. Without 
+ * arguments the events recorded so far are printed as JSON, and `-r` 
+ * drops them. Anything else prints the usage and fails with status 2.
+ * 
+ * @param args The arguments passed to the `trace` command.
+ * @param ms A pointer to the shell structure holding the tracer.
+ */
+void	handle_trace(char **args, t_ms *ms)
+{
+	ms->exit_status = 0;
+	if (!args[1])
+		trace_dump(ms, STDOUT_FILENO);
+	else if (ft_strcmp(args[1], "on") == 0 && !args[2])
+		ms->trace.on = true;
+	else if (ft_strcmp(args[1], "off") == 0 && !args[2])
+		ms->trace.on = false;
+	else if (ft_strcmp(args[1], "-r") == 0 && !args[2])
+		trace_clear(&ms->trace);
+	else
+	{
+		ft_putstr_fd(OWN_ERR_MSG, STDERR_FILENO);
+		ft_putstr_fd(TRACE_USAGE, STDERR_FILENO);
+		ms->exit_status = 2;
+	}
+}
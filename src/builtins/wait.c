@@ -0,0 +1,146 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   wait.c                                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: agent <agent@local>                        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 02:17:15 by agent             #+#    #+#             */
+/*   Updated: 2026/10/17 02:17:15 by agent            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../include/minishell.h"
+
+/**
+ * @brief Parses a pid or job number.
+ * 
+ * @param s The string to parse.
+ * 
+ * @return The number, or -1 if `s` is not a short string of digits.
+ */
+static int	parse_number(const char *s)
+{
+	int	n;
+	int	i;
+
+	n = 0;
+	i = 0;
+	while (ft_isdigit(s[i]) && i < 9)
+		n = n * 10 + (s[i++] - '0');
+	if (i == 0 || s[i])
+		return (-1);
+	return (n);
+}
+
+/**
+ * @brief Waits for every process of a job and removes the job.
+ * 
+ * @param ms A pointer to the main shell structure.
+ * @param job The job to wait for.
+ * @param pid The process whose status is wanted, or 0 for the last stage.
+ * 
+ * @return The exit status of the process or of the job's last stage.
+ */
+static int	wait_job(t_ms *ms, t_job *job, pid_t pid)
+{
+	int	status;
+	int	i;
+
+	reap_children(job->kids, job->n);
+	status = job->kids[job->n - 1].status;
+	i = 0;
+	while (pid > 0 && i < job->n)
+	{
+		if (job->kids[i].pid == pid)
+			status = job->kids[i].status;
+		i++;
+	}
+	job_remove(ms, job);
+	return (status);
+}
+
+/**
+ * @brief Prints an error for a `wait` operand that names no job.
+ * 
+ * @param arg The operand.
+ * @param msg The end of the message.
+ * @param pid Whether the operand is a pid, which bash prefixes with "pid".
+ */
+static void	print_wait_error(char *arg, char *msg, t_bool pid)
+{
+	ft_putstr_fd(OWN_ERR_MSG, STDERR_FILENO);
+	ft_putstr_fd("wait: ", STDERR_FILENO);
+	if (pid)
+		ft_putstr_fd("pid ", STDERR_FILENO);
+	else if (msg[0] == '\'')
+		ft_putstr_fd("`", STDERR_FILENO);
+	ft_putstr_fd(arg, STDERR_FILENO);
+	ft_putstr_fd(msg, STDERR_FILENO);
+}
+
+/**
+ * @brief Waits for the job named by one `wait` operand.
+ * 
+ * The operand is either a pid or `%N` for job number N.
+ * 
+ * @param ms A pointer to the main shell structure.
+ * @param arg The operand.
+ * 
+ * @return The exit status of the waited process, 127 if the operand names 
+ *         no child of the shell, 2 if it is neither a pid nor a job.
+ */
+static int	wait_arg(t_ms *ms, char *arg)
+{
+	t_job	*job;
+	int		n;
+
+	n = parse_number(arg + (arg[0] == '%'));
+	if (n < 0)
+	{
+		print_wait_error(arg, WAIT_SPEC_ERR, false);
+		return (2);
+	}
+	if (arg[0] == '%')
+		job = job_find(ms, 0, n);
+	else
+		job = job_find(ms, n, 0);
+	if (!job && arg[0] == '%')
+		print_wait_error(arg, WAIT_JOB_ERR, false);
+	else if (!job)
+		print_wait_error(arg, WAIT_CHILD_ERR, true);
+	if (!job)
+		return (127);
+	if (arg[0] == '%')
+		n = 0;
+	return (wait_job(ms, job, n));
+}
+
+/**
+ * @brief Handles the `wait` builtin.
+ * 
+ * Without operands every background job is waited for and the status is 
+ * 0. Otherwise each operand is waited for in turn and the status is the 
+ * one of the last operand.
+ * 
+ * @param args The arguments passed to the `wait` command.
+ * @param ms A pointer to the shell structure holding the job table.
+ */
+void	handle_wait(char **args, t_ms *ms)
+{
+	int	i;
+
+	ms->exit_status = 0;
+	if (!args[1])
+	{
+		while (ms->jobs.first)
+			wait_job(ms, ms->jobs.first, 0);
+		return ;
+	}
+	i = 1;
+	while (args[i])
+	{
+		ms->exit_status = wait_arg(ms, args[i]);
+		i++;
+	}
+}
@@ -6,63 +6,28 @@
 /*   By: ssalorin <ssalorin@student.hive.fi>        +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/03/27 13:35:32 by ssalorin          #+#    #+#             */
-/*   Updated: 2025/03/27 13:35:34 by ssalorin         ###   ########.fr       */
+/*   Updated: 2026/10/17 02:31:20 by agent            ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "../../include/minishell.h"
 
 /**
- * @brief Cleans up temporary heredoc files by unlinking them and freeing 
- *        the associated memory.
- *
- * This function iterates over the `filenames` array, unlinking each file 
- * (removing it from the filesystem). If unlinking fails, it prints an error, 
- * sets the exit status to indicate a system error, and stops further unlinking. 
- * After all files are processed or an error occurs, the function frees the 
- * memory associated with the `filenames` array.
- *
- * @param filenames An array of filenames representing temporary heredoc 
- *                  files to be cleaned up.
- * @param ms The shell structure containing the exit status to be updated 
- *           if an error occurs.
- */
-void	cleanup_heredocs(char **filenames, t_ms *ms)
-{
-	int		i;
-
-	i = 0;
-	if (!filenames)
-		return ;
-	while (filenames[i])
-	{
-		if (unlink(filenames[i]) == -1)
-		{
-			perror("unlink fail");
-			ms->exit_status = SYSTEM_ERR;
-			break ;
-		}
-		i++;
-	}
-	clean_arr(&filenames);
-}
-
-/**
- * @brief Frees the allocated memory for process IDs in a pipeline structure.
+ * @brief Frees the child table of a pipeline structure.
  * 
- * This function checks if the `p->pids` array exists and frees it to prevent 
- * memory leaks. It then sets the pointer to `NULL` to avoid accidental 
- * access to freed memory.
+ * This function checks if the `p->stages` table exists, closes the pidfds 
+ * it still holds and frees it to prevent leaks. It then sets the pointer 
+ * to `NULL` to avoid accidental access to freed memory.
  * 
- * @param p A pointer to the `t_pipe` structure containing the process ID 
- *          array.
+ * @param p A pointer to the `t_pipe` structure containing the child table.
  */
 void	free_pids(t_pipe *p)
 {
-	if (p->pids)
+	if (p->stages)
 	{
-		free(p->pids);
-		p->pids = NULL;
+		children_release(p->stages, p->num_cmds);
+		free(p->stages);
+		p->stages = NULL;
 	}
 }
 
@@ -70,8 +35,8 @@ void	free_pids(t_pipe *p)
  * @brief Frees all allocated memory in ms structure.
  * 
  * This function cleans up and deallocates all dynamically allocated resources 
- * within the `t_ms` structure, including environment variables, token lists, 
- * blocks, and other. Finally, it frees the `t_ms` structure itself.
+ * within the `t_ms` structure, including environment variables, the token 
+ * vector, blocks, and other. Finally, it frees the `t_ms` structure itself.
  * 
  * @param ms A pointer to the `t_ms` structure to be cleaned. If `ms` is NULL, 
  *        the function does nothing.
@@ -80,20 +45,23 @@ void	clean_struct(t_ms *ms)
 {
 	if (!ms)
 		return ;
-	if (ms->envp)
-		clean_arr(&(ms->envp));
-	if (ms->exported)
-		clean_arr(&(ms->exported));
-	if (ms->heredoc_files)
-		clean_arr(&(ms->heredoc_files));
-	if (ms->tokens)
-		clean_token_list(&(ms->tokens));
+	env_free(&ms->env);
+	free(ms->tokens.arr);
+	free(ms->line.toks.arr);
+	free(ms->line.text);
+	pcache_clear(&ms->pcache);
 	if (ms->blocks)
 		clean_block_list(&(ms->blocks));
-	if (ms->heredoc_files)
-		cleanup_heredocs(ms->heredoc_files, ms);
 	if (ms->pwd)
 		free(ms->pwd);
+	reader_free(&(ms->reader));
+	hash_clear(ms);
+	arena_free(&ms->arena);
+	reset_heredocs(ms);
+	free(ms->heredocs.fds);
+	sb_free(&ms->pipestatus);
+	jobs_clear(ms);
+	trace_clear(&ms->trace);
 	free(ms);
 }
 
@@ -113,22 +81,33 @@ void	clean_in_child(t_ms *ms)
 }
 
 /**
- * @brief Cleans up allocated memory and temporary files after command execution.
+ * @brief Cleans up allocated memory after command execution.
  * 
  * This function performs cleanup operations after executing a command or 
- * pipeline. It ensures that temporary files, token lists, command structures, 
- * and any allocated resources related to heredocs are properly freed.
+ * pipeline. Tokens, blocks and commands are released in one step by 
+ * resetting the line arena, and the line's heredocs are closed. The input 
+ * line, which the raw tokens point into, is freed, as is the text of a 
+ * background command that did not become a job. A parse cache emptied by 
+ * `parsecache -r` during the line is cleared only now, since the line's 
+ * tokens may still point into its entries.
  * 
  * @param ms The main shell structure containing environment data and execution 
  *           context.
  */
 void	clean_struct_partially(t_ms *ms)
 {
-	if (ms->heredoc_files)
-		cleanup_heredocs(ms->heredoc_files, ms);
-	ms->heredoc_count = 0;
-	ms->heredoc_files = NULL;
-	clean_token_list(&(ms->tokens));
+	clean_token_list(&ms->tokens);
 	clean_block_list(&(ms->blocks));
 	clean_cmd_list(&(ms->cmds));
+	reset_heredocs(ms);
+	arena_reset(&ms->arena);
+	clean_token_list(&ms->line.toks);
+	free(ms->line.text);
+	ms->line.text = NULL;
+	ms->line.list = NULL;
+	if (ms->pcache.drop)
+		pcache_clear(&ms->pcache);
+	free(ms->jobs.line);
+	ms->jobs.line = NULL;
+	ms->jobs.background = false;
 }
@@ -6,7 +6,7 @@
 /*   By: ssalorin <ssalorin@student.hive.fi>        +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/03/27 13:35:42 by ssalorin          #+#    #+#             */
-/*   Updated: 2025/03/27 13:35:44 by ssalorin         ###   ########.fr       */
+/*   Updated: 2026/10/17 02:51:06 by agent            ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -46,7 +46,8 @@ void	close_file(int file)
  * @brief Closes all file descriptors associated with a pipeline.
  * 
  * This function closes the input and output file descriptors stored in the 
- * `fd` array of the `t_pipe` structure, as well as the `cur_fd` descriptor.
+ * `fd` array of the `t_pipe` structure, as well as the `cur_fd` descriptor 
+ * and the descriptors kept for a deferred `cat` stage.
  * It ensures that resources are properly released.
  * 
  * @param p A pointer to the `t_pipe` structure containing the file descriptors.
@@ -56,6 +57,7 @@ void	close_pipe_fds(t_pipe *p)
 	close_file(p->fd[0]);
 	close_file(p->fd[1]);
 	close_file(p->cur_fd);
+	close_two_fds(p->pump.in, p->pump.out);
 }
 
 /**
@@ -64,7 +66,8 @@ void	close_pipe_fds(t_pipe *p)
  * This function iterates through a linked list of commands, closing the input 
  * (`infile`) and output (`outfile`) file descriptors for each command. 
  * The function checks that the file descriptors are valid and not set to 
- * default values (`DEF`) or invalid values (`NO_FD`) before closing them.
+ * default values (`DEF`) or invalid values (`NO_FD`) before closing them. 
+ * Heredoc inputs are left to the heredoc registry.
  * 
  * @param cmd A pointer to the first command in the linked list of commands.
  */
@@ -75,7 +78,8 @@ void	close_every_cmds_fds(t_cmd *cmd)
 	cur = cmd;
 	while (cur)
 	{
-		close_file(cur->infile);
+		if (!cur->heredoc)
+			close_file(cur->infile);
 		close_file(cur->outfile);
 		cur = cur->next;
 	}
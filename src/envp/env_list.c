@@ -0,0 +1,114 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   env_list.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: agent <agent@local>                        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 01:18:03 by agent             #+#    #+#             */
+/*   Updated: 2026/10/17 01:19:07 by agent            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../include/minishell.h"
+
+/**
+ * @brief Appends a variable to the end of the insertion-ordered list.
+ * 
+ * @param env A pointer to the environment store.
+ * @param var The variable to append.
+ */
+void	env_link_last(t_env *env, t_var *var)
+{
+	var->next = NULL;
+	var->prev = env->last;
+	if (env->last)
+		env->last->next = var;
+	else
+		env->first = var;
+	env->last = var;
+}
+
+/**
+ * @brief Takes a variable out of the insertion-ordered list.
+ * 
+ * The variable stays in the hash table.
+ * 
+ * @param env A pointer to the environment store.
+ * @param var The variable to unlink.
+ */
+void	env_unlink(t_env *env, t_var *var)
+{
+	if (var->prev)
+		var->prev->next = var->next;
+	else
+		env->first = var->next;
+	if (var->next)
+		var->next->prev = var->prev;
+	else
+		env->last = var->prev;
+	var->prev = NULL;
+	var->next = NULL;
+}
+
+/**
+ * @brief Returns the environment as a NULL-terminated `char **` for `execve`.
+ * 
+ * The array only holds variables with a value, in insertion order. It points 
+ * at the entries of the store, so building it copies no strings, and it is 
+ * only rebuilt after a variable with a value has changed. The array belongs 
+ * to the store and is invalidated by the next change.
+ * 
+ * @param ms A pointer to the shell structure owning the store.
+ * 
+ * @return The environment array, or NULL if memory allocation fails.
+ */
+char	**env_snapshot(t_ms *ms)
+{
+	t_env	*env;
+	t_var	*var;
+	size_t	i;
+
+	env = &ms->env;
+	if (env->snapshot && !env->dirty)
+		return (env->snapshot);
+	free(env->snapshot);
+	env->snapshot = malloc(sizeof(char *) * (env->count + 1));
+	if (!env->snapshot)
+		return (print_malloc_set_status(ms));
+	i = 0;
+	var = env->first;
+	while (var)
+	{
+		if (var->value)
+			env->snapshot[i++] = var->entry;
+		var = var->next;
+	}
+	env->snapshot[i] = NULL;
+	env->dirty = false;
+	return (env->snapshot);
+}
+
+/**
+ * @brief Frees every variable of the store and the store's arrays.
+ * 
+ * @param env A pointer to the environment store.
+ */
+void	env_free(t_env *env)
+{
+	t_var	*var;
+	t_var	*next;
+
+	var = env->first;
+	while (var)
+	{
+		next = var->next;
+		free(var->entry);
+		free(var);
+		var = next;
+	}
+	free(env->buckets);
+	free(env->sorted);
+	free(env->snapshot);
+	ft_memset(env, 0, sizeof(t_env));
+}
@@ -0,0 +1,119 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   env_set.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: agent <agent@local>                        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 01:18:03 by agent             #+#    #+#             */
+/*   Updated: 2026/10/17 01:18:03 by agent            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../include/minishell.h"
+
+/**
+ * @brief Builds the `KEY=value` string stored for a variable.
+ * 
+ * A variable without a value is stored as the bare name, the way it is 
+ * listed by `export`.
+ * 
+ * @param key The variable name.
+ * @param klen The length of the name.
+ * @param value The value, or NULL for a variable without a value.
+ * 
+ * @return The newly allocated entry, or NULL if the allocation failed.
+ */
+static char	*make_entry(const char *key, size_t klen, const char *value)
+{
+	char	*entry;
+	size_t	vlen;
+
+	vlen = 0;
+	if (value)
+		vlen = ft_strlen(value) + 1;
+	entry = malloc(klen + vlen + 1);
+	if (!entry)
+		return (NULL);
+	ft_memcpy(entry, key, klen);
+	if (value)
+	{
+		entry[klen] = '=';
+		ft_memcpy(entry + klen + 1, value, vlen - 1);
+	}
+	entry[klen + vlen] = '\0';
+	return (entry);
+}
+
+/**
+ * @brief Creates a variable and adds it to the store.
+ * 
+ * @param env A pointer to the environment store.
+ * @param key The variable name.
+ * @param value The value, or NULL for a variable without a value.
+ * 
+ * @return `1` on success, `0` if memory allocation fails.
+ */
+static int	env_add(t_env *env, const char *key, const char *value)
+{
+	t_var	*var;
+
+	var = ft_calloc(1, sizeof(t_var));
+	if (!var)
+		return (0);
+	var->klen = ft_strlen(key);
+	var->entry = make_entry(key, var->klen, value);
+	if (!var->entry)
+	{
+		free(var);
+		return (0);
+	}
+	if (value)
+		var->value = var->entry + var->klen + 1;
+	if (!env_insert(env, var))
+	{
+		free(var->entry);
+		free(var);
+		return (0);
+	}
+	return (1);
+}
+
+/**
+ * @brief Sets a variable, creating it if it does not exist.
+ * 
+ * With a NULL `value` the variable is only declared: an existing variable 
+ * keeps its value. A variable that gets its first value is moved to the end 
+ * of the list, so it shows up in `env` after the ones that already had one, 
+ * as it did when values were appended to the `envp` array.
+ * 
+ * @param env A pointer to the environment store.
+ * @param key The variable name.
+ * @param value The new value, or NULL.
+ * 
+ * @return `1` on success, `0` if memory allocation fails.
+ */
+int	env_set(t_env *env, const char *key, const char *value)
+{
+	t_var	*var;
+	char	*entry;
+
+	var = env_get(env, key);
+	if (!var)
+		return (env_add(env, key, value));
+	if (!value)
+		return (1);
+	entry = make_entry(key, var->klen, value);
+	if (!entry)
+		return (0);
+	if (!var->value)
+	{
+		env_unlink(env, var);
+		env_link_last(env, var);
+	}
+	free(var->entry);
+	var->entry = entry;
+	var->value = entry + var->klen + 1;
+	env->dirty = true;
+	return (1);
+}
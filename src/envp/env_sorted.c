@@ -0,0 +1,136 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   env_sorted.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: agent <agent@local>                        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 01:19:07 by agent             #+#    #+#             */
+/*   Updated: 2026/10/17 01:19:07 by agent            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../include/minishell.h"
+
+/**
+ * @brief Compares the name of a variable with a key.
+ * 
+ * Names are compared byte by byte, and a name sorts before every longer 
+ * name it is a prefix of, so the order does not depend on the values.
+ * 
+ * @param var The variable to compare.
+ * @param key The key to compare against. It does not need a terminator.
+ * @param len The length of the key.
+ * 
+ * @return A negative, zero or positive value like `ft_strcmp`.
+ */
+static int	key_cmp(t_var *var, const char *key, size_t len)
+{
+	size_t	n;
+	int		diff;
+
+	n = var->klen;
+	if (len < n)
+		n = len;
+	diff = ft_strncmp(var->entry, key, n);
+	if (diff)
+		return (diff);
+	if (var->klen < len)
+		return (-1);
+	return (var->klen > len);
+}
+
+/**
+ * @brief Finds the position of a key in the sorted index.
+ * 
+ * @param env A pointer to the environment store.
+ * @param key The key to look for.
+ * @param len The length of the key.
+ * 
+ * @return The index of the first variable that does not sort before `key`.
+ */
+static size_t	sorted_pos(t_env *env, const char *key, size_t len)
+{
+	size_t	lo;
+	size_t	hi;
+	size_t	mid;
+
+	lo = 0;
+	hi = env->count;
+	while (lo < hi)
+	{
+		mid = lo + (hi - lo) / 2;
+		if (key_cmp(env->sorted[mid], key, len) < 0)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+	return (lo);
+}
+
+/**
+ * @brief Doubles the capacity of the sorted index.
+ * 
+ * @param env A pointer to the environment store.
+ * 
+ * @return `1` on success, `0` if the allocation failed.
+ */
+static int	sorted_grow(t_env *env)
+{
+	t_var	**sorted;
+	size_t	cap;
+
+	cap = env->sorted_cap * 2;
+	if (cap == 0)
+		cap = ENV_BUCKETS;
+	sorted = malloc(sizeof(t_var *) * cap);
+	if (!sorted)
+		return (0);
+	if (env->sorted)
+		ft_memcpy(sorted, env->sorted, sizeof(t_var *) * env->count);
+	free(env->sorted);
+	env->sorted = sorted;
+	env->sorted_cap = cap;
+	return (1);
+}
+
+/**
+ * @brief Adds a new variable to the alphabetically sorted index.
+ * 
+ * The position is found with a binary search, so `export` never has to sort 
+ * the whole environment again.
+ * 
+ * @param env A pointer to the environment store.
+ * @param var The variable to add. It must not be in the store yet.
+ * 
+ * @return `1` on success, `0` if the index could not be grown.
+ */
+int	env_sorted_insert(t_env *env, t_var *var)
+{
+	size_t	pos;
+
+	if (env->count >= env->sorted_cap && !sorted_grow(env))
+		return (0);
+	pos = sorted_pos(env, var->entry, var->klen);
+	ft_memmove(env->sorted + pos + 1, env->sorted + pos,
+		sizeof(t_var *) * (env->count - pos));
+	env->sorted[pos] = var;
+	return (1);
+}
+
+/**
+ * @brief Removes a variable from the alphabetically sorted index.
+ * 
+ * @param env A pointer to the environment store.
+ * @param var The variable to remove.
+ */
+void	env_sorted_remove(t_env *env, t_var *var)
+{
+	size_t	pos;
+
+	pos = sorted_pos(env, var->entry, var->klen);
+	if (pos >= env->count || env->sorted[pos] != var)
+		return ;
+	ft_memmove(env->sorted + pos, env->sorted + pos + 1,
+		sizeof(t_var *) * (env->count - pos - 1));
+}
@@ -0,0 +1,161 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   env_store.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: agent <agent@local>                        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 01:18:03 by agent             #+#    #+#             */
+/*   Updated: 2026/10/17 01:19:07 by agent            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../include/minishell.h"
+
+/**
+ * @brief Computes the bucket index of a variable name.
+ * 
+ * Uses the djb2 string hash, like the command path table.
+ * 
+ * @param key The variable name.
+ * @param len The length of the name.
+ * @param size The number of buckets in the table.
+ * 
+ * @return The bucket index, between `0` and `size - 1`.
+ */
+static size_t	env_hash(const char *key, size_t len, size_t size)
+{
+	size_t	hash;
+	size_t	i;
+
+	hash = 5381;
+	i = 0;
+	while (i < len)
+		hash = hash * 33 + (unsigned char)key[i++];
+	return (hash % size);
+}
+
+/**
+ * @brief Doubles the bucket array and rehashes every variable.
+ * 
+ * The table starts with `ENV_BUCKETS` buckets and grows whenever it holds as 
+ * many variables as buckets, so chains stay short no matter how many 
+ * variables are exported.
+ * 
+ * @param env A pointer to the environment store.
+ * 
+ * @return `1` on success, `0` if the new bucket array could not be allocated.
+ */
+static int	env_grow(t_env *env)
+{
+	t_var	**buckets;
+	t_var	*var;
+	size_t	size;
+	size_t	idx;
+
+	size = env->size * 2;
+	if (size == 0)
+		size = ENV_BUCKETS;
+	buckets = ft_calloc(size, sizeof(t_var *));
+	if (!buckets)
+		return (0);
+	var = env->first;
+	while (var)
+	{
+		idx = env_hash(var->entry, var->klen, size);
+		var->hnext = buckets[idx];
+		buckets[idx] = var;
+		var = var->next;
+	}
+	free(env->buckets);
+	env->buckets = buckets;
+	env->size = size;
+	return (1);
+}
+
+/**
+ * @brief Looks up a variable by name.
+ * 
+ * @param env A pointer to the environment store.
+ * @param key The name of the variable.
+ * 
+ * @return A pointer to the variable, or NULL if it does not exist.
+ */
+t_var	*env_get(t_env *env, const char *key)
+{
+	t_var	*var;
+	size_t	len;
+
+	if (!env->size)
+		return (NULL);
+	len = ft_strlen(key);
+	var = env->buckets[env_hash(key, len, env->size)];
+	while (var)
+	{
+		if (var->klen == len && ft_strncmp(var->entry, key, len) == 0)
+			return (var);
+		var = var->hnext;
+	}
+	return (NULL);
+}
+
+/**
+ * @brief Adds a new variable to the hash table, the sorted index and the end 
+ *        of the list.
+ * 
+ * @param env A pointer to the environment store.
+ * @param var The variable to add. It must not already be in the store.
+ * 
+ * @return `1` on success, `0` if the table could not be grown.
+ */
+int	env_insert(t_env *env, t_var *var)
+{
+	size_t	idx;
+
+	if (env->count >= env->size && !env_grow(env))
+		return (0);
+	if (!env_sorted_insert(env, var))
+		return (0);
+	idx = env_hash(var->entry, var->klen, env->size);
+	var->hnext = env->buckets[idx];
+	env->buckets[idx] = var;
+	env_link_last(env, var);
+	env->count++;
+	if (var->value)
+		env->dirty = true;
+	return (1);
+}
+
+/**
+ * @brief Removes a variable from the store and frees it.
+ * 
+ * Removing a name that does not exist is not an error.
+ * 
+ * @param env A pointer to the environment store.
+ * @param key The name of the variable to remove.
+ */
+void	env_unset(t_env *env, const char *key)
+{
+	t_var	**link;
+	t_var	*var;
+	size_t	len;
+
+	if (!env->size)
+		return ;
+	len = ft_strlen(key);
+	link = &env->buckets[env_hash(key, len, env->size)];
+	while (*link && ((*link)->klen != len
+			|| ft_strncmp((*link)->entry, key, len) != 0))
+		link = &(*link)->hnext;
+	var = *link;
+	if (!var)
+		return ;
+	*link = var->hnext;
+	env_unlink(env, var);
+	env_sorted_remove(env, var);
+	env->count--;
+	if (var->value)
+		env->dirty = true;
+	free(var->entry);
+	free(var);
+}
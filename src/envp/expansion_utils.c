@@ -6,122 +6,91 @@
 /*   By: ssalorin <ssalorin@student.hive.fi>        +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/03/27 13:36:08 by ssalorin          #+#    #+#             */
-/*   Updated: 2025/03/27 13:36:10 by ssalorin         ###   ########.fr       */
+/*   Updated: 2026/10/17 02:17:15 by agent            ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "../../include/minishell.h"
 
 /**
- * @brief Appends a dynamically allocated string to the result string.
+ * @brief Returns the number a special parameter expands to.
  * 
- * This function concatenates `new_part` to `*result`, creating a new 
- * dynamically allocated string. The original `*result` is freed after 
- * concatenation. If memory allocation fails, an error message is printed, 
- * the shell's exit status is set to `MALLOC_ERR`, and `new_part` is freed.
+ * @param c The parameter: `?` for the exit status, `!` for the pid of the 
+ *          last background job.
+ * @param ms The shell structure holding both.
  * 
- * @param result A pointer to the dynamically allocated result string. It is 
- *               updated with the newly concatenated string.
- * @param new_part A dynamically allocated string to be appended to `*result`. 
- *                 It is freed after use.
- * @param ms A pointer to the `t_ms` structure, which manages shell-related
- *           data, including exit status.
- * 
- * @return None. The function modifies `*result` and updates `ms->exit_status` 
- *         on failure.
+ * @return The value of the parameter.
  */
-static void	append_to_result(char **result, char *new_part, t_ms *ms)
+static int	special_number(char c, t_ms *ms)
 {
-	char	*temp;
-
-	if (!new_part)
-		return ;
-	temp = ft_strjoin(*result, new_part);
-	if (!temp)
-	{
-		print_malloc_set_status(ms);
-		free(new_part);
-		return ;
-	}
-	free(*result);
-	*result = temp;
-	free(new_part);
+	if (c == '!')
+		return (ms->jobs.last_pid);
+	return (ms->exit_status);
 }
 
 /**
- * @brief Retrieves the value of an environment variable.
+ * @brief Looks up the value of a variable for expansion.
  * 
- * This function searches for an environment variable in the given `envp` array
- * by matching the key stored in `exp->key`. If found, it returns a newly 
- * allocated string containing the variable's value. If `exp->quote` is 0, 
- * extra spaces in the value are removed using `handle_spaces`. If the key is 
- * not found, an empty string is returned.
+ * `PIPESTATUS` is not an environment variable: it comes from the exit 
+ * codes recorded after the last command, and is "0" before any has run.
  * 
- * @param envp The array of environment variables.
- * @param exp A pointer to the `t_expand` structure containing the key to
- *            search for.
+ * @param key The name of the variable.
+ * @param ms The shell structure holding the environment.
  * 
- * @return A dynamically allocated string containing the environment variable's 
- *         value. Returns an empty string if the key is not found or `NULL` if 
- *         memory allocation fails.
+ * @return The value, or NULL if the variable is not set.
  */
-static char	*find_env_value(char **envp, t_expand *exp)
+static const char	*variable_value(char *key, t_ms *ms)
 {
-	int		i;
-	char	*copy;
-
-	i = 0;
-	while (envp[i])
-	{
-		if (ft_strncmp(envp[i], exp->key, exp->len) == 0
-			&& envp[i][exp->len] && envp[i][exp->len] == '=')
-		{
-			copy = ft_strdup(envp[i] + exp->len + 1);
-			if (!copy)
-				return (NULL);
-			if (exp->quote == 0)
-				return (handle_spaces(copy, exp));
-			else
-				return (copy);
-		}
-		i++;
-	}
-	return (ft_strdup(""));
+	if (ft_strcmp(key, "PIPESTATUS") == 0 && !ms->pipestatus.buf)
+		return ("0");
+	if (ft_strcmp(key, "PIPESTATUS") == 0)
+		return (ms->pipestatus.buf);
+	return (get_env_value(key, ms));
 }
 
 /**
- * @brief Expands a shell variable and appends its value to the result string.
+ * @brief Expands a shell variable and appends its value to the builder.
  *
- * This function expands a shell variable based on its key. If the key is "?",
- * it appends the exit status. If the key is a number, it appends an empty 
- * string. For other keys, it looks up the value in the environment variables.
- * The  expanded value is then appended to the `result` string. If memory 
- * allocation fails during the process, it prints an error and updates the 
- * exit status to indicate a failure.
+ * This function expands a shell variable based on its key. If the key is "?", 
+ * it appends the exit status, and "!" the pid of the last background job. If 
+ * the key is a number, nothing is appended. `PIPESTATUS` expands to the exit 
+ * codes of the stages of the last pipeline. For other keys, it looks up the 
+ * value in the environment variables; when `exp->quote` is 0, extra spaces in 
+ * the value are collapsed with `handle_spaces`. If memory allocation fails 
+ * during the process, it prints an error and updates the exit status to 
+ * indicate a failure.
  *
  * @param ms The shell structure containing the current state, including the 
  *           exit status and environment variables.
- * @param exp The structure containing the key of the variable to expand and 
- *            the result to append to.
- * @param result A pointer to the string where the expanded variable value will 
- *               be appended.
+ * @param exp The structure containing the key of the variable to expand.
+ * @param sb A pointer to the string builder receiving the expanded value.
+ * 
+ * @return `1` on success, `0` if memory allocation fails.
  */
-void	expand_variable(t_ms *ms, t_expand *exp, char **result)
+int	expand_variable(t_ms *ms, t_expand *exp, t_strbuf *sb)
 {
-	char	*expanded;
+	const char	*value;
+	char		*status;
+	int			ret;
 
-	if (!exp->key || !*(exp->key))
-		return ;
-	if (exp->key[0] == '?')
-		expanded = ft_itoa(ms->exit_status);
-	else if (ft_isdigit(exp->key[0]))
-		expanded = ft_strdup("");
-	else
-		expanded = find_env_value(ms->envp, exp);
-	if (!expanded)
+	if (!exp->key || !*(exp->key) || ft_isdigit(exp->key[0]))
+		return (1);
+	if (exp->key[0] == '?' || (exp->key[0] == '!' && ms->jobs.last_pid))
 	{
-		print_malloc_set_status(ms);
-		return ;
+		status = ft_itoa(special_number(exp->key[0], ms));
+		if (!status)
+		{
+			print_malloc_set_status(ms);
+			return (0);
+		}
+		ret = sb_append(sb, status, ft_strlen(status), ms);
+		free(status);
+		return (ret);
 	}
-	append_to_result(result, expanded, ms);
+	value = variable_value(exp->key, ms);
+	if (!value)
+		return (1);
+	if (exp->quote == 0)
+		return (handle_spaces(sb, value, exp, ms));
+	return (sb_append(sb, value, ft_strlen(value), ms));
 }
@@ -6,65 +6,21 @@
 /*   By: ssalorin <ssalorin@student.hive.fi>        +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/03/27 13:36:19 by ssalorin          #+#    #+#             */
-/*   Updated: 2025/03/27 13:36:21 by ssalorin         ###   ########.fr       */
+/*   Updated: 2026/10/17 02:17:15 by agent            ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "../../include/minishell.h"
 
-/**
- * @brief Appends a single character to a dynamically allocated string.
- * 
- * This function takes a character and appends it to the given string by 
- * creating a new string with the additional character. If memory allocation 
- * fails at any point, an error message is printed, and the shell's exit 
- * status is set to `MALLOC_ERR`.
- * 
- * @param result A pointer to the dynamically allocated string to which the 
- *               character will be appended. The original memory is freed 
- *               after concatenation.
- * @param c The character to append.
- * @param ms A pointer to the `t_ms` structure, which manages shell-related 
- *           data, including exit status.
- * 
- * @return None. The function modifies `*result` and updates `ms->exit_status` 
- *         on failure.
- */
-static void	append_literal_char(char **result, char c, t_ms *ms)
-{
-	char	*substr;
-	char	*temp;
-	char	str[2];
-
-	str[0] = c;
-	str[1] = '\0';
-	substr = ft_substr(str, 0, 1);
-	if (!substr)
-	{
-		print_malloc_set_status(ms);
-		return ;
-	}
-	temp = ft_strjoin(*result, substr);
-	if (!temp)
-	{
-		print_malloc_set_status(ms);
-		free(substr);
-		return ;
-	}
-	free(substr);
-	free(*result);
-	*result = temp;
-}
-
 /**
  * @brief Extracts a key (variable name) from an export command argument.
  * 
  * This function scans the given argument string starting at index `*i` and 
  * extracts a valid key consisting of alphanumeric characters or underscores. 
- * If the key is `?`, it extracts only that character. The function dynamically 
- * allocates memory for the key and updates `*i` to reflect the new position in 
- * the string. If memory allocation fails, an error message is printed, and the 
- * shell's exit status is set to `MALLOC_ERR`.
+ * If the key is `?` or `!`, it extracts only that character. The function 
+ * dynamically allocates memory for the key and updates `*i` to reflect the new 
+ * position in the string. If memory allocation fails, an error message is 
+ * printed, and the shell's exit status is set to `MALLOC_ERR`.
  * 
  * @param args The string containing the export argument.
  * @param i A pointer to the current index in `args`, which will be updated 
@@ -81,7 +37,7 @@ static char	*extract_key_export(char *args, int *i, t_ms *ms)
 	char	*key;
 
 	x = 0;
-	if (args[*i] == '?')
+	if (args[*i] == '?' || args[*i] == '!')
 		x = 1;
 	else
 	{
@@ -101,12 +57,11 @@ static char	*extract_key_export(char *args, int *i, t_ms *ms)
  * 
  * This function processes a dollar-sign-prefixed (`$`) variable in a string by 
  * extracting its key, determining its length, and expanding it to its 
- * corresponding value. The expanded value is then appended to the result string.
+ * corresponding value. The expanded value is appended to the string builder.
  * The function also manages memory allocation failures and updates the shell's 
  * exit status if needed.
  * 
- * @param result A pointer to the string where the expanded value will be 
- *               appended.
+ * @param sb A pointer to the string builder receiving the expanded value.
  * @param exp A pointer to the `t_expand` structure, which stores expansion-
  *            related data.
  * @param i A pointer to the current index in `exp->data`, which is incremented 
@@ -117,92 +72,74 @@ static char	*extract_key_export(char *args, int *i, t_ms *ms)
  * @return Returns `0` if memory allocation fails, setting `ms->exit_status` 
  *         to `MALLOC_ERR`, otherwise returns `1` on success.
  */
-static int	dollar_expansion(char **result, t_expand *exp, int *i, t_ms *ms)
+static int	dollar_expansion(t_strbuf *sb, t_expand *exp, int *i, t_ms *ms)
 {
+	int	ret;
+
 	(*i)++;
 	exp->key = extract_key_export(exp->data, i, ms);
 	if (!exp->key)
 		return (0);
 	exp->len = ft_strlen(exp->key);
-	expand_variable(ms, exp, result);
+	ret = expand_variable(ms, exp, sb);
 	exp->expanded = true;
 	free(exp->key);
-	if (ms->exit_status == MALLOC_ERR)
-		return (0);
-	return (1);
+	exp->key = NULL;
+	return (ret);
 }
 
 /**
- * @brief Expands variables in a string and appends them to the result.
+ * @brief Checks whether the `$` at `data[i]` starts a variable expansion.
+ * 
+ * @param data The string being expanded.
+ * @param i The index of a `$` character in `data`.
+ * 
+ * @return `1` if the dollar sign is followed by something expandable, 
+ *         otherwise `0`.
+ */
+static int	is_expandable(const char *data, int i)
+{
+	return (data[i] == '$' && data[i + 1] && data[i + 1] != '$'
+		&& !ft_isspace(data[i + 1]) && data[i + 1] != '/');
+}
+
+/**
+ * @brief Expands variables in a string into a string builder.
  *
  * This function iterates through the `exp->data` string, looking for dollar 
  * signs ('$') that indicate the presence of variables to expand. When a
- * variable is detected, it calls `dollar_expansion` to handle the expansion 
- * and append the result. If memory allocation fails at any point, the 
- * function cleans up and returns `NULL`. Literal characters are appended 
- * directly to the `result` string. The function returns the final expanded
- *  string.
+ * variable is detected, it calls `dollar_expansion` to handle the expansion. 
+ * Everything up to the next dollar sign is appended as one literal run, so 
+ * expanding a string costs time linear in its length. Heredoc lines are 
+ * expanded this way straight into the heredoc body.
  *
  * @param exp The structure containing the string data to be expanded and other 
  *            expansion details.
  * @param ms The shell structure containing execution state information, 
  *           including exit status.
- * @param result A pointer to the string where expanded variable values and 
- *               literals will be appended.
+ * @param sb A pointer to the string builder receiving the result.
  * 
- * @return The expanded result string or `NULL` if an error occurs during memory 
- *         allocation.
+ * @return `1` on success, `0` if memory allocation fails.
  */
-static char	*expand(t_expand *exp, t_ms *ms, char **result)
+int	expand_to_builder(t_expand *exp, t_ms *ms, t_strbuf *sb)
 {
 	int		i;
+	int		start;
 
 	i = 0;
 	while (exp->data[i])
 	{
-		if (exp->data[i] == '$' && exp->data[i + 1] && exp->data[i + 1] != '$'
-			&& !ft_isspace(exp->data[i + 1]) && exp->data[i + 1] != '/')
-		{
-			if (!dollar_expansion(result, exp, &i, ms))
-			{
-				free(*result);
-				return (NULL);
-			}
-		}
-		else
-			append_literal_char(result, exp->data[i++], ms);
-		if (ms->exit_status == MALLOC_ERR)
+		if (is_expandable(exp->data, i))
 		{
-			free(*result);
-			return (NULL);
+			if (!dollar_expansion(sb, exp, &i, ms))
+				return (0);
+			continue ;
 		}
+		start = i++;
+		while (exp->data[i] && exp->data[i] != '$')
+			i++;
+		if (!sb_append(sb, exp->data + start, i - start, ms))
+			return (0);
 	}
-	return (*result);
-}
-
-/**
- * @brief Handles the expansion of variables in a string.
- *
- * This function initializes an empty string, attempts to allocate memory for 
- * it, and calls the `expand` function to process the variable expansion. If 
- * memory allocation fails, it prints an error message, sets the exit status 
- * to `MALLOC_ERR`, and returns `NULL`. Otherwise, it returns the result of 
- * the expansion.
- *
- * @param exp The structure containing the string data to be expanded and other 
- *            expansion details.
- * @param ms The shell structure containing execution state information, 
- *           including exit status.
- * 
- * @return A string containing the expanded variables, or `NULL` if memory 
- *         allocation fails.
- */
-char	*handle_expansion(t_expand *exp, t_ms *ms)
-{
-	char	*result;
-
-	result = ft_strdup("");
-	if (!result)
-		return (print_malloc_set_status(ms));
-	return (expand(exp, ms, &result));
+	return (1);
 }
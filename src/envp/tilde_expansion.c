@@ -6,7 +6,7 @@
 /*   By: ssalorin <ssalorin@student.hive.fi>        +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/03/31 16:59:52 by ssalorin          #+#    #+#             */
-/*   Updated: 2025/03/31 16:59:55 by ssalorin         ###   ########.fr       */
+/*   Updated: 2026/10/17 01:52:35 by agent            ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -39,10 +39,8 @@ int	expand_tilde(t_token *cur, t_ms *ms)
 	home = get_home_directory(ms, 1);
 	if (!home)
 		return (0);
-	if (cur->data[1] == '\0')
-		new_data = ft_strdup(home);
-	else if (cur->data[1] == '/')
-		new_data = ft_strjoin(home, &cur->data[1]);
+	if (cur->data[1] == '\0' || cur->data[1] == '/')
+		new_data = arena_strjoin(ms, home, &cur->data[1]);
 	else
 	{
 		free(home);
@@ -51,43 +49,6 @@ int	expand_tilde(t_token *cur, t_ms *ms)
 	free(home);
 	if (!new_data)
 		return (1);
-	free(cur->data);
 	cur->data = new_data;
 	return (0);
 }
-
-/**
- * @brief Scans a list of tokens and expands tilde (`~`) where applicable.
- * 
- * This function iterates through a linked list of tokens and checks for 
- * the tilde (`~`) character at the beginning of each token's data. If the 
- * token is not enclosed in single (`'`) or double (`"`) quotes, the tilde 
- * is expanded to the user's home directory.
- * 
- * @param first A pointer to the first token in the list.
- * @param ms A pointer to the main shell structure, used to retrieve the home 
- *           directory.
- * 
- * @return Returns `0` if successful, or `1` if an expansion fails due to memory 
- *         allocation errors.
- */
-int	check_list_for_tilde(t_token *first, t_ms *ms)
-{
-	t_token	*cur;
-
-	cur = first;
-	while (cur)
-	{
-		if (cur->type == WORD && cur->quote != SG_QUOT && cur->quote != DB_QUOT
-			&& cur->data[0] == '~')
-		{
-			if (expand_tilde(cur, ms) == 1)
-			{
-				print_malloc_set_status(ms);
-				return (1);
-			}
-		}
-		cur = cur->next;
-	}
-	return (0);
-}
@@ -6,7 +6,7 @@
 /*   By: ssalorin <ssalorin@student.hive.fi>        +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/03/27 13:41:54 by ssalorin          #+#    #+#             */
-/*   Updated: 2025/03/27 13:41:56 by ssalorin         ###   ########.fr       */
+/*   Updated: 2026/10/17 03:37:20 by agent            ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -15,10 +15,11 @@
 /**
  * @brief Prints an error message based on a specified reason.
  * 
- * This function prints a generic error message (`OWN_ERR_MSG`) followed by 
- * a specific error message based on the provided `reason`. For example, 
- * if the `reason` is `HIST_RD_ERR`, it will print an error message indicating 
- * a failure to read from the history file. The error message is printed to 
+ * This function prints a generic error message (`OWN_ERR_MSG`) followed by a 
+ * specific error message based on the provided `reason`. For example, if the 
+ * `reason` is `HIST_RD_ERR`, it will print an error message indicating a 
+ * failure to read from the history file; `INPUT_RD_ERR` adds the reason a read 
+ * of the shell's input failed, from `errno`. The error message is printed to 
  * `stderr` to notify the user about the specific error.
  * 
  * @param reason The reason for the error, which determines the specific 
@@ -31,6 +32,8 @@ void	print_system_error(t_print reason)
 	ft_putstr_fd(OWN_ERR_MSG, STDERR_FILENO);
 	if (reason == HIST_RD_ERR)
 		ft_putendl_fd(HISTORY_RD_ERR, STDERR_FILENO);
+	if (reason == INPUT_RD_ERR)
+		perror("read");
 }
 
 /**
@@ -52,10 +55,12 @@ void	print_syntax_error(char *text)
 	if (*text == NULL_TERM)
 		text = "newline";
 	else if (ft_strncmp(text, "||", 2) == 0 || ft_strncmp(text, "&&", 2) == 0
-		|| ft_strncmp(text, ">>", 2) == 0 || ft_strncmp(text, "<<", 2) == 0)
+		|| ft_strncmp(text, ">>", 2) == 0 || ft_strncmp(text, "<<", 2) == 0
+		|| ft_strncmp(text, ";;", 2) == 0)
 		cut = 2;
 	else if (*text == VERTICAL || *text == L_PARENT || *text == R_PARENT
-		|| *text == L_REDIR || *text == R_REDIR || *text == AND)
+		|| *text == L_REDIR || *text == R_REDIR || *text == AND
+		|| *text == SCOLON)
 		cut = 1;
 	else if (ft_isalnum(*text) == 1 || *text == SG_QUOT || *text == DB_QUOT)
 		while (ft_isalnum(text[cut]) == 1 || text[cut] == SG_QUOT
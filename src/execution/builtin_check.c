@@ -6,7 +6,7 @@
 /*   By: ssalorin <ssalorin@student.hive.fi>        +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/03/27 13:52:11 by ssalorin          #+#    #+#             */
-/*   Updated: 2025/03/27 13:52:12 by ssalorin         ###   ########.fr       */
+/*   Updated: 2026/10/17 02:44:16 by agent            ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -22,8 +22,9 @@
  *            string to check.
  * 
  * @return Returns `1` if the command is a built-in (`echo`, `cd`, `pwd`, 
- *         `export`, `unset`, `env`, `exit`), otherwise returns `0`. If 
- *         `cmd->name` is NULL, returns `0`.
+ *         `export`, `unset`, `env`, `exit`, `hash`, `parsecache`, `jobs`, 
+ *         `wait`, `trace`, `memstat`), otherwise returns `0`. If `cmd->name` 
+ *         is NULL, returns `0`.
  */
 int	is_builtin(t_cmd *cmd)
 {
@@ -35,11 +36,40 @@ int	is_builtin(t_cmd *cmd)
 		(ft_strcmp(cmd->name, "export") == 0) || \
 		(ft_strcmp(cmd->name, "unset") == 0) || \
 		(ft_strcmp(cmd->name, "env") == 0) || \
-		(ft_strcmp(cmd->name, "exit") == 0))
+		(ft_strcmp(cmd->name, "exit") == 0) || \
+		(ft_strcmp(cmd->name, "hash") == 0) || \
+		(ft_strcmp(cmd->name, "parsecache") == 0) || \
+		(ft_strcmp(cmd->name, "jobs") == 0) || \
+		(ft_strcmp(cmd->name, "wait") == 0) || \
+		(ft_strcmp(cmd->name, "trace") == 0) || \
+		(ft_strcmp(cmd->name, "memstat") == 0))
 		return (1);
 	return (0);
 }
 
+/**
+ * @brief Executes the built-ins this shell adds to the required ones.
+ * 
+ * @param cmd A pointer to the command, whose `name` is one of `hash`, 
+ *            `parsecache`, `jobs`, `wait`, `trace` or `memstat`.
+ * @param ms A pointer to a `t_ms` structure representing the shell state.
+ */
+static void	handle_shell_builtin(t_cmd *cmd, t_ms *ms)
+{
+	if (ft_strcmp(cmd->name, "hash") == 0)
+		handle_hash(cmd->args, ms);
+	else if (ft_strcmp(cmd->name, "parsecache") == 0)
+		handle_parsecache(cmd->args, ms);
+	else if (ft_strcmp(cmd->name, "jobs") == 0)
+		handle_jobs(cmd->args, ms);
+	else if (ft_strcmp(cmd->name, "wait") == 0)
+		handle_wait(cmd->args, ms);
+	else if (ft_strcmp(cmd->name, "trace") == 0)
+		handle_trace(cmd->args, ms);
+	else if (ft_strcmp(cmd->name, "memstat") == 0)
+		handle_memstat(cmd->args, ms);
+}
+
 /**
  * @brief Executes the corresponding function for a built-in command.
  *        The function determines which built-in command is being called and
@@ -67,15 +97,19 @@ void	handle_builtin(t_cmd *cmd, t_ms *ms)
 		handle_env(cmd->args, ms);
 	else if (ft_strcmp(cmd->name, "exit") == 0)
 		check_exit(cmd->args, ms);
+	else
+		handle_shell_builtin(cmd, ms);
 }
 
 /**
  * @brief Determines whether a built-in command should be executed in a child 
  *        process.
  * 
- * Some built-in commands, such as `cd`, `exit`, `unset`, and `export` (with 
- * arguments), should be executed in the main process. This function checks the 
- * command type and decides if a child process is required.
+ * Some built-in commands, such as `cd`, `exit`, `unset`, `jobs`, `wait`, 
+ * and `export`, `hash`, `parsecache` or `trace` (with arguments), should be 
+ * executed in the main process, where the state they use or change lives. 
+ * This function checks the command type and decides if a child process is 
+ * required.
  * 
  * @param cmd A pointer to the `t_cmd` structure containing the command 
  *            details. The `name` field specifies the command, and `args` 
@@ -89,7 +123,12 @@ int	if_children_needed(t_cmd *cmd)
 	if (ft_strcmp(cmd->name, "cd") == 0 || \
 		ft_strcmp(cmd->name, "exit") == 0 || \
 		ft_strcmp(cmd->name, "unset") == 0 || \
-		(ft_strcmp(cmd->name, "export") == 0 && cmd->args[1]))
+		(ft_strcmp(cmd->name, "export") == 0 && cmd->args[1]) || \
+		(ft_strcmp(cmd->name, "hash") == 0 && cmd->args[1]) || \
+		(ft_strcmp(cmd->name, "parsecache") == 0 && cmd->args[1]) || \
+		(ft_strcmp(cmd->name, "trace") == 0 && cmd->args[1]) || \
+		ft_strcmp(cmd->name, "jobs") == 0 || \
+		ft_strcmp(cmd->name, "wait") == 0)
 		return (false);
 	return (true);
 }
@@ -0,0 +1,122 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   file_pump.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: agent <agent@local>                        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 02:51:06 by agent             #+#    #+#             */
+/*   Updated: 2026/10/17 02:51:06 by agent            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef _GNU_SOURCE
+# define _GNU_SOURCE
+#endif
+#include <fcntl.h>
+#include <errno.h>
+#include "../../include/minishell.h"
+
+/**
+ * @brief Copies a file descriptor to another one through a buffer.
+ * 
+ * This is the fallback of `pump_fd` for the inputs `splice` refuses. Short 
+ * writes are resumed and interrupted calls are retried.
+ * 
+ * @param in The file descriptor to read from.
+ * @param out The file descriptor to write to.
+ * 
+ * @return 0 at the end of the input, -1 on an error with `errno` set.
+ */
+static int	copy_by_read(int in, int out)
+{
+	char	buf[PUMP_BUF];
+	ssize_t	got;
+	ssize_t	put;
+	ssize_t	done;
+
+	got = 1;
+	while (got > 0)
+	{
+		got = read(in, buf, PUMP_BUF);
+		done = 0;
+		while (got > 0 && done < got)
+		{
+			put = write(out, buf + done, got - done);
+			if (put < 0 && errno != EINTR)
+				return (-1);
+			if (put > 0)
+				done += put;
+		}
+		if (got < 0 && errno == EINTR)
+			got = 1;
+	}
+	return ((int)got);
+}
+
+/**
+ * @brief Moves everything from a file descriptor into a pipe.
+ * 
+ * The data is moved with `splice`, which hands the pages of the input to 
+ * the pipe without copying them through user space. When the kernel 
+ * cannot splice from the input, the rest is copied with `read` and 
+ * `write`; `splice` moves the file offset, so nothing is sent twice.
+ * 
+ * @param in The file descriptor to read from.
+ * @param out The write end of a pipe.
+ * 
+ * @return 0 at the end of the input, -1 on an error with `errno` set.
+ */
+int	pump_fd(int in, int out)
+{
+	ssize_t	moved;
+
+	moved = 1;
+	while (moved > 0)
+	{
+		moved = splice(in, NULL, out, NULL, PUMP_CHUNK, SPLICE_F_MOVE);
+		if (moved < 0 && errno == EINTR)
+			moved = 1;
+	}
+	if (moved < 0 && (errno == EINVAL || errno == ENOSYS))
+		return (copy_by_read(in, out));
+	return ((int)moved);
+}
+
+/**
+ * @brief Pumps one input of a shell-side `cat` into its pipe.
+ * 
+ * A named operand is opened here and closed again afterwards; an input 
+ * that is already open is left to the caller. Errors are reported the way 
+ * `cat` reports them. A reader that went away is not an error to report: 
+ * the stage ends as if it had been killed by `SIGPIPE`.
+ * 
+ * @param name The operand to read, or "-" for an open input.
+ * @param in The open input, or -1 to open `name`.
+ * @param out The write end of the pipe to the next stage.
+ * 
+ * @return The exit status of the stage: 0, 1 on an error or 141 when the 
+ *         reader closed the pipe.
+ */
+int	pump_file(char *name, int in, int out)
+{
+	int	fd;
+	int	err;
+
+	fd = in;
+	if (fd < 0)
+		fd = open(name, O_RDONLY);
+	err = 0;
+	if (fd < 0 || pump_fd(fd, out) < 0)
+		err = errno;
+	if (fd >= 0 && fd != in)
+		close(fd);
+	if (err == EPIPE)
+		return (128 + SIGPIPE);
+	if (!err)
+		return (0);
+	ft_putstr_fd("cat: ", STDERR_FILENO);
+	errno = err;
+	perror(name);
+	return (1);
+}
@@ -6,7 +6,7 @@
 /*   By: ssalorin <ssalorin@student.hive.fi>        +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/03/27 13:52:28 by ssalorin          #+#    #+#             */
-/*   Updated: 2025/03/27 13:52:30 by ssalorin         ###   ########.fr       */
+/*   Updated: 2026/10/17 03:05:02 by agent            ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -57,45 +57,86 @@ static char	*make_full_path(char **paths, char *cmd, t_ms *ms)
  * @brief Finds the full path of a command by searching the PATH 
  *        environment variable.
  * 
- * This function iterates through the environment variables to find the "PATH" 
- * variable. It then splits the value of "PATH" into individual directories, 
- * searching each for the specified command. The function returns the full path 
+ * This function looks up the "PATH" variable in the environment store. It 
+ * then splits the value of "PATH" into individual directories, searching 
+ * each for the specified command. The function returns the full path 
  * of the command if found. If memory allocation fails or the "PATH" variable 
  * is empty, it handles errors accordingly.
  * 
- * @param envp A pointer to the environment variables.
- * @param cmds A pointer to the array of command arguments (the first argument 
- *             is the command to search for).
+ * @param cmd The command to search for.
  * @param ms A pointer to the main shell structure, used to handle errors 
  *           and status.
  * 
  * @return The full path to the command if found, or NULL if not found or 
  *         if an error occurs.
  */
-static char	*find_path_from_envp(char **envp, char **cmds, t_ms *ms)
+char	*find_path_from_envp(char *cmd, t_ms *ms)
 {
-	int		i;
 	char	*path_var;
 	char	**paths;
 	char	*full_path;
 
-	i = -1;
-	while (envp[++i])
+	path_var = get_env_value("PATH", ms);
+	if (!path_var || path_var[0] == '\0')
+		return (NULL);
+	paths = ft_split(path_var, ':');
+	if (!paths)
+		return (print_malloc_set_status(ms));
+	full_path = make_full_path(paths, cmd, ms);
+	clean_arr(&paths);
+	return (full_path);
+}
+
+/**
+ * @brief Resolves a command through the PATH hash table.
+ * 
+ * A remembered location is reused as long as the file still exists there, 
+ * which costs one `access` call instead of a walk over every `PATH` entry. 
+ * On a miss the `PATH` directories are searched and the result is added to 
+ * the table. Each successful lookup counts as a hit. A name containing a 
+ * slash is a path, not a command to look up, and is never hashed.
+ * 
+ * @param name The command to resolve.
+ * @param ms A pointer to the main shell structure holding the table.
+ * 
+ * @return A newly allocated full path, or NULL if the command was not found 
+ *         or an allocation failed.
+ */
+char	*resolve_cmd_path(char *name, t_ms *ms)
+{
+	t_hash	*entry;
+	char	*path;
+
+	if (ft_strchr(name, '/'))
+		return (NULL);
+	entry = hash_get(ms, name);
+	if (!entry || access(entry->path, F_OK) != 0)
 	{
-		if (ft_strncmp(envp[i], "PATH=", 5) == 0)
-		{
-			path_var = envp[i] + 5;
-			if (path_var[0] == '\0')
-				return (NULL);
-			paths = ft_split(path_var, ':');
-			if (!paths)
-				return (print_malloc_set_status(ms));
-			full_path = make_full_path(paths, cmds[0], ms);
-			clean_arr(&paths);
-			return (full_path);
-		}
+		path = find_path_from_envp(name, ms);
+		if (!path)
+			return (NULL);
+		entry = hash_insert(ms, name, path);
+		free(path);
+		if (!entry)
+			return (print_malloc_set_status(ms));
 	}
-	return (NULL);
+	entry->hits++;
+	path = ft_strdup(entry->path);
+	if (!path)
+		return (print_malloc_set_status(ms));
+	return (path);
+}
+
+/**
+ * @brief Cleans up the child's copy of the shell and exits.
+ * 
+ * @param ms The minishell struct to clean up.
+ * @param status The exit status of the child.
+ */
+static void	exit_in_child(t_ms *ms, int status)
+{
+	clean_in_child(ms);
+	exit(status);
 }
 
 /**
@@ -103,14 +144,15 @@ static char	*find_path_from_envp(char **envp, char **cmds, t_ms *ms)
  * 
  * Handles different cases based on the command format:
  * - If the command consists only of dots, prints an error and exits.  
- * - If it is an absolute or relative path, attempts to execute it.  
+ * - If it contains a slash or starts with a dot, it is a path and is 
+ *   executed as it is.  
  * - If no PATH variable is found, handles execution without PATH.  
- * - Otherwise, searches for the command in the PATH directories.  
+ * - Otherwise, resolves the command through the PATH hash table.  
  * 
  * If a valid path is found, it runs with execve. If execution fails due to  
  * permission issues, prints an error and exits.  
  * 
- * @param envp The environment variables.  
+ * @param envp The environment variables, or NULL if building them failed.  
  * @param cmd The command and its arguments.  
  * @param ms The minishell struct for cleanup and error handling.  
  * 
@@ -122,26 +164,24 @@ static char	*find_path_from_envp(char **envp, char **cmds, t_ms *ms)
 void	execute_command(char **envp, char **cmd, t_ms *ms)
 {
 	char	*path;
+
+	if (!envp)
+		exit_in_child(ms, MALLOC_ERR);
 	check_if_dot(cmd, ms);
-	if (cmd[0][0] == '/' || cmd[0][0] == '.')
+	if (ft_strchr(cmd[0], '/') || cmd[0][0] == '.')
 		handle_absolute_or_relative_path(envp, cmd, ms);
-	if (!get_env_value("PATH", envp))
+	if (!get_env_value("PATH", ms))
 		handle_no_path_variable(envp, cmd, ms);
-	path = find_path_from_envp(envp, cmd, ms);
+	path = resolve_cmd_path(cmd[0], ms);
 	if (ms->exit_status == MALLOC_ERR)
-	{
-		clean_in_child(ms);
-		exit(MALLOC_ERR);
-	}
+		exit_in_child(ms, MALLOC_ERR);
 	if (!path)
 	{
 		print_cmd_error(cmd[0], NO_CMD);
-		clean_in_child(ms);
-		exit(CMD_NF);
+		exit_in_child(ms, CMD_NF);
 	}
 	execve(path, cmd, envp);
 	print_cmd_error(path, PERM_DEN);
 	free(path);
-	clean_in_child(ms);
-	exit(CMD_EXEC);
+	exit_in_child(ms, CMD_EXEC);
 }
@@ -0,0 +1,147 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   inline_builtin.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: agent <agent@local>                        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 02:07:51 by agent             #+#    #+#             */
+/*   Updated: 2026/10/17 02:54:12 by agent            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../include/minishell.h"
+
+/**
+ * @brief Checks whether a pipeline stage can run inside the shell.
+ * 
+ * Only `echo`, `pwd` and `env` qualify: they write to standard output and 
+ * never read standard input or change the shell state. The last stage is 
+ * always forked, so the exit status of the pipeline still comes from a 
+ * child, and a stage whose redirection failed keeps the old behaviour.
+ * 
+ * @param cur The command of the current stage.
+ * @param p The pipe structure of the running pipeline.
+ * 
+ * @return 1 if the stage may run in the shell, 0 otherwise.
+ */
+static int	is_inline_stage(t_cmd *cur, t_pipe *p)
+{
+	if (p->cmd_num >= p->num_cmds - 1 || !cur->name
+		|| cur->infile == NO_FD || cur->outfile == NO_FD)
+		return (0);
+	return (ft_strcmp(cur->name, "echo") == 0
+		|| ft_strcmp(cur->name, "pwd") == 0
+		|| ft_strcmp(cur->name, "env") == 0);
+}
+
+/**
+ * @brief Returns an upper bound for the output of an inline builtin.
+ * 
+ * `echo` prints its arguments separated by spaces, `env` prints one line 
+ * per exported variable and `pwd` prints either the `getcwd` result, which 
+ * fits in 1024 bytes, or the saved working directory.
+ * 
+ * @param cur The command of the current stage.
+ * @param ms A pointer to the main shell structure.
+ * 
+ * @return The largest number of bytes the builtin can write.
+ */
+static size_t	output_size(t_cmd *cur, t_ms *ms)
+{
+	char	**lines;
+	size_t	size;
+	size_t	i;
+
+	size = 1;
+	if (ft_strcmp(cur->name, "pwd") == 0)
+	{
+		if (ms->pwd)
+			size += ft_strlen(ms->pwd);
+		return (size + 1024);
+	}
+	lines = cur->args;
+	if (ft_strcmp(cur->name, "env") == 0 && !cur->args[1])
+		lines = env_snapshot(ms);
+	else if (ft_strcmp(cur->name, "env") == 0)
+		return (0);
+	i = 0;
+	while (lines && lines[i])
+		size += ft_strlen(lines[i++]) + 1;
+	return (size);
+}
+
+/**
+ * @brief Runs a builtin with its standard output moved to another file.
+ * 
+ * The shell's own standard output is saved, replaced by `fd` for the 
+ * duration of the builtin and restored afterwards. The exit status of the 
+ * builtin goes to the stage's entry in the child table; the one of the 
+ * shell is left untouched, as the stage is not the last one.
+ * 
+ * @param cur The command to run.
+ * @param fd The file descriptor the builtin writes to.
+ * @param p The pipe structure of the running pipeline.
+ * 
+ * @return 1 if the builtin ran, 0 if the descriptors could not be set up.
+ */
+static int	run_with_stdout(t_cmd *cur, int fd, t_pipe *p)
+{
+	int	saved;
+	int	status;
+
+	saved = fcntl(STDOUT_FILENO, F_DUPFD_CLOEXEC, 3);
+	if (saved < 0)
+		return (0);
+	if (dup2(fd, STDOUT_FILENO) < 0)
+	{
+		close(saved);
+		return (0);
+	}
+	status = p->ms->exit_status;
+	handle_builtin(cur, p->ms);
+	p->stages[p->cmd_num].status = p->ms->exit_status;
+	p->ms->exit_status = status;
+	dup2(saved, STDOUT_FILENO);
+	close(saved);
+	return (1);
+}
+
+/**
+ * @brief Runs an output-only builtin stage without forking.
+ * 
+ * When the stage qualifies, the pipe to the next stage is created here and the 
+ * builtin writes straight into it from the shell. Nothing reads the pipe until 
+ * the next stage starts, so the builtin only runs inline when its whole output 
+ * fits in a quarter of the pipe capacity; the kernel may leave part of each 
+ * pipe page unused, and the margin keeps the write from blocking; a larger 
+ * `PIPE_SIZE` lets larger outputs run inline. A stage with its own output file 
+ * writes there instead and the next stage reads an empty pipe. On success the 
+ * read end becomes the input of the next stage; the stage keeps its child 
+ * table entry without a pid, so it is never waited for.
+ * 
+ * @param cur The command of the current stage.
+ * @param p The pipe structure of the running pipeline.
+ * 
+ * @return 1 if the stage ran in the shell, 0 if it must be forked.
+ */
+int	run_inline_builtin(t_cmd *cur, t_pipe *p)
+{
+	int	target;
+
+	if (!is_inline_stage(cur, p) || open_pipe(p) == -1)
+		return (0);
+	target = cur->outfile;
+	if (target == DEF)
+		target = p->fd[1];
+	if ((cur->outfile == DEF
+			&& output_size(cur, p->ms) > pipe_capacity(p->fd[1]) / 4)
+		|| !run_with_stdout(cur, target, p))
+	{
+		close_two_fds(p->fd[0], p->fd[1]);
+		return (0);
+	}
+	close_two_fds(p->cur_fd, p->fd[1]);
+	p->cur_fd = p->fd[0];
+	return (1);
+}
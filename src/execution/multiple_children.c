@@ -6,57 +6,12 @@
 /*   By: ssalorin <ssalorin@student.hive.fi>        +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/03/27 13:52:34 by ssalorin          #+#    #+#             */
-/*   Updated: 2025/03/27 13:52:35 by ssalorin         ###   ########.fr       */
+/*   Updated: 2026/10/17 02:54:12 by agent            ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "../../include/minishell.h"
 
-/**
- * @brief Waits for all child processes to finish and updates the exit status.
- *
- * This function waits for all child processes to terminate, checks their exit 
- * statuses, and updates the minishell's exit status based on the results. If 
- * a child process terminates with a signal, it adjusts the exit status 
- * accordingly. Specifically, if the process was terminated by `SIGINT`, it 
- * sets the exit status to 130, and if by `SIGQUIT`, it sets it to 131. 
- * Additionally, it writes the appropriate message to `stderr` when a process 
- * exits due to a signal.
- *
- * @param last_pid The PID of the last child process, used to check if it was 
- * the one that finished.
- * @param ms The minishell structure containing the exit status and other 
- * relevant state.
- * @param p The current pipe structure containing the number of commands and 
- * other pipe-related info.
- */
-static void	wait_for_children(pid_t last_pid, t_ms *ms, t_pipe *p)
-{
-	int		i;
-	int		status;
-	pid_t	wpid;
-
-	i = 0;
-	while (i < p->num_cmds)
-	{
-		wpid = wait(&status);
-		if (wpid == last_pid && WIFEXITED(status))
-			ms->exit_status = WEXITSTATUS(status);
-		if (WIFSIGNALED(status))
-		{
-			if (wpid == last_pid && WTERMSIG(status) == SIGINT)
-				ms->exit_status = 130;
-			if (wpid == last_pid && WTERMSIG(status) == SIGQUIT)
-				ms->exit_status = 131;
-			if (WTERMSIG(status) == SIGINT)
-				write(STDERR_FILENO, "\n", 1);
-		}
-		i++;
-	}
-	if (ms->exit_status == 131)
-		write(STDERR_FILENO, "Quit\n", 5);
-}
-
 /**
  * @brief Executes a child process in a pipeline.
  * 
@@ -107,15 +62,16 @@ static void	child_process(t_cmd *cur, t_pipe *p, t_cmd *cmds)
 		exit(exit_num);
 	}
 	else
-		execute_command(p->ms->envp, cur->args, p->ms);
+		execute_command(env_snapshot(p->ms), cur->args, p->ms);
 }
 
 /**
  * @brief Forks a new process to execute a command and sets up pipes.
  * 
- * This function creates a pipe for inter-process communication, forks a 
- * child process to execute a command, and manages file descriptors for 
- * proper data flow.
+ * This function creates a pipe for inter-process communication, sized by 
+ * `PIPE_SIZE` when it is set, launches the command with `start_process` (a 
+ * spawn, or a fork when it cannot be spawned), and manages file descriptors 
+ * for proper data flow. The child is registered in the pipeline's child table.
  * 
  * @param cur The current command to execute.
  * @param p A pointer to the pipe structure managing process execution.
@@ -127,33 +83,32 @@ static void	child_process(t_cmd *cur, t_pipe *p, t_cmd *cmds)
  */
 static void	fork_and_execute(t_cmd *cur, t_pipe *p, t_cmd *cmds)
 {
-	if (pipe(p->fd) == -1)
+	pid_t	pid;
+
+	if (open_pipe(p) == -1)
 	{
 		perror("pipe failed");
 		p->ms->exit_status = SYSTEM_ERR;
 		return ;
 	}
-	p->pids[p->cmd_num] = fork();
-	if (p->pids[p->cmd_num] < 0)
-	{
-		perror("fork failed");
-		p->ms->exit_status = SYSTEM_ERR;
+	pid = start_process(cur, cmds, p, p->ms);
+	if (pid < 0)
 		return ;
-	}
-	if (p->pids[p->cmd_num] == 0)
+	if (pid == 0)
 		child_process(cur, p, cmds);
+	child_watch(&p->stages[p->cmd_num], pid);
 	close_two_fds(p->cur_fd, p->fd[1]);
 	p->cur_fd = p->fd[0];
-	p->last_pid = p->pids[p->cmd_num];
 }
 
 /**
  * @brief Initializes the `t_pipe` structure for managing command execution.
  * 
- * This function sets up the `t_pipe` structure, which handles multiple commands 
- * in a pipeline. It initializes values such as the number of commands, process 
- * tracking variables, and allocates memory for storing process IDs. If memory 
- * allocation fails, an error is printed.
+ * This function sets up the `t_pipe` structure, which handles multiple 
+ * commands in a pipeline. It initializes values such as the number of 
+ * commands, process tracking variables and the pipe size from `PIPE_SIZE`, and 
+ * allocates the child table that records the pid and exit status of every 
+ * stage. If memory allocation fails, an error is printed.
  * 
  * @param p A pointer to the `t_pipe` structure to be initialized.
  * @param num_cmds The total number of commands in the pipeline.
@@ -167,12 +122,35 @@ static void	initialize_p(t_pipe *p, int num_cmds, t_ms *ms)
 {
 	p->num_cmds = num_cmds;
 	p->ms = ms;
-	p->last_pid = -1;
 	p->cmd_num = 0;
 	p->cur_fd = -1;
-	p->pids = (pid_t *)malloc((p->num_cmds) * sizeof(pid_t));
-	if (!p->pids)
-		print_malloc_set_status(ms);
+	p->pipe_size = pipe_size_setting(ms);
+	p->pump.cmd = NULL;
+	p->pump.stage = 0;
+	p->pump.in = -1;
+	p->pump.out = -1;
+	p->stages = children_new(num_cmds, ms);
+}
+
+/**
+ * @brief Collects the children of a started pipeline.
+ * 
+ * A foreground pipeline is reaped, which sets the exit status and the 
+ * codes of `$PIPESTATUS`. A background pipeline hands its child table over 
+ * to the job table instead and the shell does not wait for it.
+ * 
+ * @param p A pointer to the pipe structure of the pipeline.
+ */
+static void	finish_pipeline(t_pipe *p)
+{
+	if (p->ms->jobs.background)
+	{
+		job_add(p->ms, p->stages, p->num_cmds);
+		p->stages = NULL;
+		return ;
+	}
+	finish_children(p->stages, p->num_cmds, p->ms);
+	record_pipestatus(p->stages, p->num_cmds, p->ms);
 }
 
 /**
@@ -180,10 +158,14 @@ static void	initialize_p(t_pipe *p, int num_cmds, t_ms *ms)
  *
  * This function handles the creation of child processes for each command in a 
  * pipeline, by forking a new process for each one and executing the 
- * corresponding command. It initializes the necessary pipes, handles 
- * the process forking, and ensures that the file descriptors are properly 
- * managed. After forking the child processes, it waits for them to complete 
- * and updates the minishell's exit status accordingly.
+ * corresponding command. Output-only builtins that are not the last stage run 
+ * inside the shell instead, see `run_inline_builtin`, and so does one `cat` of 
+ * files, whose data is pumped once every stage has started, see `defer_pump`. 
+ * It initializes the necessary pipes, handles the process forking, and ensures 
+ * that the file descriptors are properly managed. After forking the child 
+ * processes, it reaps them by pid, sets the minishell's exit status from the 
+ * last stage and records the status of every stage for `$PIPESTATUS`. A 
+ * background pipeline is handed to the job table instead.
  *
  * @param num_cmds The number of commands to execute in the pipeline.
  * @param cmds A linked list of command structures, each representing a command 
@@ -197,21 +179,24 @@ void	make_multiple_children(int num_cmds, t_cmd *cmds, t_ms *ms)
 
 	cur = cmds;
 	initialize_p(&p, num_cmds, ms);
-	if (!p.pids)
+	if (!p.stages)
 		return ;
 	while (p.cmd_num < p.num_cmds && cur)
 	{
-		fork_and_execute(cur, &p, cmds);
+		if (!run_inline_builtin(cur, &p) && !defer_pump(cur, &p))
+			fork_and_execute(cur, &p, cmds);
 		if (ms->exit_status == MALLOC_ERR
 			|| ms->exit_status == SYSTEM_ERR)
 		{
+			close_two_fds(p.pump.in, p.pump.out);
 			free_pids(&p);
 			return ;
 		}
 		cur = cur->next;
 		p.cmd_num++;
 	}
-	wait_for_children(p.last_pid, p.ms, &p);
+	run_pump(&p);
+	finish_pipeline(&p);
 	close_pipe_fds(&p);
 	free_pids(&p);
 }
@@ -6,7 +6,7 @@
 /*   By: ssalorin <ssalorin@student.hive.fi>        +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/03/27 13:52:38 by ssalorin          #+#    #+#             */
-/*   Updated: 2025/03/27 13:52:40 by ssalorin         ###   ########.fr       */
+/*   Updated: 2026/10/17 02:31:20 by agent            ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -48,24 +48,67 @@ void	execute_child(t_cmd *cmd, t_ms *ms)
 		exit(exit_num);
 	}
 	else
-		execute_command(ms->envp, cmd->args, ms);
+		execute_command(env_snapshot(ms), cmd->args, ms);
+}
+
+/**
+ * @brief Starts the process of one command, by `posix_spawn` or by `fork`.
+ * 
+ * External commands are launched with `spawn_command`; when that is not 
+ * possible a child process is forked instead. A background process joins 
+ * its job's process group, and the time taken is traced as a `spawn` 
+ * event of the new process.
+ * 
+ * @param cur The command to start.
+ * @param cmds The first command of the pipeline.
+ * @param p A pointer to the pipe structure, or NULL for a simple command.
+ * @param ms A pointer to the main shell structure.
+ * 
+ * @return The pid of the new process in the shell, 0 in a forked child, or 
+ *         -1 if the process could not be started; the error is reported 
+ *         and the exit status set.
+ */
+pid_t	start_process(t_cmd *cur, t_cmd *cmds, t_pipe *p, t_ms *ms)
+{
+	pid_t		pid;
+	long long	start;
+
+	start = trace_begin(ms);
+	pid = spawn_command(cur, cmds, p, ms);
+	if (ms->exit_status == MALLOC_ERR)
+		return (-1);
+	if (pid == 0)
+		pid = fork();
+	if (pid < 0)
+	{
+		perror("fork failed");
+		ms->exit_status = SYSTEM_ERR;
+		return (-1);
+	}
+	job_setpgid(ms, pid);
+	if (pid > 0)
+		trace_end(ms, "spawn", start, pid);
+	return (pid);
 }
 
 /**
  * @brief Creates and executes a single child process for a command.
  * 
- * This function forks a child process to execute a single command. After 
- * forking, the parent process waits for the child process to complete. The 
- * exit status of the child process is checked to update the shell's exit 
- * status based on its termination (normal exit or signal termination).
+ * The command is started by `start_process`, which spawns external commands 
+ * and forks a child process for the rest (builtins, error cases). The 
+ * parent process then waits for the child process to complete, through the 
+ * same reaper as pipelines; a background command is added to the job table 
+ * instead. The exit status of the child process is checked to update the 
+ * shell's exit status based on its termination (normal exit or signal 
+ * termination).
  * 
  * - If the command arguments are empty, the function returns without forking.
  * - If the fork fails, an error message is printed, and the shell exit 
  *   status is set to `SYSTEM_ERR`.
  * - If the child process terminates normally, the shell's exit status is 
  *   updated accordingly.
- * - If the child process is terminated by a signal (SIGINT or SIGQUIT), 
- *   the exit status is updated to reflect the corresponding signal.
+ * - If the child process is terminated by a signal, the exit status is 
+ *   128 plus the signal number, e.g. 130 for SIGINT and 131 for SIGQUIT.
  * 
  * @param cmd The command structure containing the arguments and details of 
  *            the command to be executed.
@@ -75,28 +118,16 @@ void	execute_child(t_cmd *cmd, t_ms *ms)
 void	make_one_child(t_cmd *cmd, t_ms *ms)
 {
 	pid_t	pid;
-	int		status;
 
 	if (!cmd->args || !cmd->args[0])
 		return ;
-	pid = fork();
+	pid = start_process(cmd, cmd, NULL, ms);
 	if (pid < 0)
-	{
-		perror("fork failed");
-		ms->exit_status = SYSTEM_ERR;
 		return ;
-	}
 	if (pid == 0)
 		execute_child(cmd, ms);
-	waitpid(pid, &status, 0);
-	if (WIFEXITED(status))
-		ms->exit_status = WEXITSTATUS(status);
-	if (WIFSIGNALED(status) && WTERMSIG(status) == SIGINT)
-		ms->exit_status = 130;
-	if (WIFSIGNALED(status) && WTERMSIG(status) == SIGQUIT)
-		ms->exit_status = 131;
-	if (ms->exit_status == 130)
-		write(STDERR_FILENO, "\n", 1);
-	if (ms->exit_status == 131)
-		write(STDERR_FILENO, "Quit\n", 5);
+	if (ms->jobs.background)
+		job_add_pid(ms, pid);
+	else
+		finish_child(pid, ms);
 }
@@ -0,0 +1,129 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   path_hash.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: agent <agent@local>                        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 01:05:11 by agent             #+#    #+#             */
+/*   Updated: 2026/10/17 01:06:24 by agent            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../include/minishell.h"
+
+/**
+ * @brief Computes the bucket of a command name in the PATH hash table.
+ * 
+ * Uses the djb2 string hash reduced to `HASH_SIZE` buckets.
+ * 
+ * @param name The command name to hash.
+ * 
+ * @return The index of the bucket the name belongs to.
+ */
+static unsigned int	hash_index(char *name)
+{
+	unsigned int	hash;
+
+	hash = 5381;
+	while (*name)
+	{
+		hash = hash * 33 + (unsigned char)*name;
+		name++;
+	}
+	return (hash % HASH_SIZE);
+}
+
+/**
+ * @brief Looks up a command name in the PATH hash table.
+ * 
+ * @param ms A pointer to the shell structure holding the table.
+ * @param name The command name to look for.
+ * 
+ * @return The table entry of the command, or NULL if it is not hashed.
+ */
+t_hash	*hash_get(t_ms *ms, char *name)
+{
+	t_hash	*entry;
+
+	entry = ms->cmd_hash[hash_index(name)];
+	while (entry)
+	{
+		if (ft_strcmp(entry->name, name) == 0)
+			return (entry);
+		entry = entry->next;
+	}
+	return (NULL);
+}
+
+/**
+ * @brief Stores the resolved path of a command in the PATH hash table.
+ * 
+ * An existing entry for the same name gets the new path and its hit count 
+ * is reset, otherwise a new entry is added to the front of its bucket.
+ * 
+ * @param ms A pointer to the shell structure holding the table.
+ * @param name The command name.
+ * @param path The full path the command was found at; it is copied.
+ * 
+ * @return The stored entry, or NULL if an allocation failed.
+ */
+t_hash	*hash_insert(t_ms *ms, char *name, char *path)
+{
+	t_hash	*entry;
+	char	*copy;
+
+	copy = ft_strdup(path);
+	if (!copy)
+		return (NULL);
+	entry = hash_get(ms, name);
+	if (!entry)
+	{
+		entry = ft_calloc(1, sizeof(t_hash));
+		if (entry)
+			entry->name = ft_strdup(name);
+		if (!entry || !entry->name)
+		{
+			free(entry);
+			free(copy);
+			return (NULL);
+		}
+		entry->next = ms->cmd_hash[hash_index(name)];
+		ms->cmd_hash[hash_index(name)] = entry;
+	}
+	free(entry->path);
+	entry->path = copy;
+	entry->hits = 0;
+	return (entry);
+}
+
+/**
+ * @brief Empties the PATH hash table.
+ * 
+ * Called by `hash -r` and whenever `PATH` is changed or unset, since every 
+ * remembered location may be stale after that.
+ * 
+ * @param ms A pointer to the shell structure holding the table.
+ */
+void	hash_clear(t_ms *ms)
+{
+	t_hash	*entry;
+	t_hash	*next;
+	int		i;
+
+	i = 0;
+	while (i < HASH_SIZE)
+	{
+		entry = ms->cmd_hash[i];
+		while (entry)
+		{
+			next = entry->next;
+			free(entry->name);
+			free(entry->path);
+			free(entry);
+			entry = next;
+		}
+		ms->cmd_hash[i] = NULL;
+		i++;
+	}
+}
@@ -6,10 +6,14 @@
 /*   By: ssalorin <ssalorin@student.hive.fi>        +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/03/27 13:57:44 by ssalorin          #+#    #+#             */
-/*   Updated: 2025/03/27 13:57:46 by ssalorin         ###   ########.fr       */
+/*   Updated: 2026/10/17 02:07:51 by agent            ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
+#ifndef _GNU_SOURCE
+# define _GNU_SOURCE
+#endif
+#include <limits.h>
 #include "../../include/minishell.h"
 
 /**
@@ -113,3 +117,44 @@ void	redirect_process(int infile, int outfile, t_ms *ms)
 			ms->exit_status = SYSTEM_ERR;
 	}
 }
+
+#ifdef F_GETPIPE_SZ
+
+/**
+ * @brief Returns the capacity of a pipe in bytes.
+ * 
+ * Linux reports the real size of the pipe buffer with `F_GETPIPE_SZ`. 
+ * When the call fails, `PIPE_BUF` is the safe lower bound.
+ * 
+ * @param fd Either end of the pipe.
+ * 
+ * @return The number of bytes the pipe can hold.
+ */
+size_t	pipe_capacity(int fd)
+{
+	int	size;
+
+	size = fcntl(fd, F_GETPIPE_SZ);
+	if (size <= 0)
+		return (PIPE_BUF);
+	return ((size_t)size);
+}
+
+#else
+
+/**
+ * @brief Returns the capacity of a pipe in bytes.
+ * 
+ * Without a way to ask the kernel, `PIPE_BUF` is the safe lower bound.
+ * 
+ * @param fd Either end of the pipe.
+ * 
+ * @return The number of bytes the pipe can hold.
+ */
+size_t	pipe_capacity(int fd)
+{
+	(void)fd;
+	return (PIPE_BUF);
+}
+
+#endif
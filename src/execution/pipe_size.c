@@ -0,0 +1,149 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   pipe_size.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: agent <agent@local>                        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 02:54:12 by agent             #+#    #+#             */
+/*   Updated: 2026/10/17 02:54:12 by agent            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef _GNU_SOURCE
+# define _GNU_SOURCE
+#endif
+#include "../../include/minishell.h"
+
+/**
+ * @brief Parses the value of `PIPE_SIZE`.
+ * 
+ * The value is a number of bytes, optionally followed by `k` or `m` for 
+ * kibibytes or mebibytes. Anything else means the default size.
+ * 
+ * @param value The value of `PIPE_SIZE`, or NULL if it is not set.
+ * 
+ * @return The requested size in bytes, or 0 for the default.
+ */
+static long	parse_pipe_size(char *value)
+{
+	long	size;
+	int		shift;
+	int		i;
+
+	if (!value || !ft_isdigit(value[0]))
+		return (0);
+	size = 0;
+	i = 0;
+	while (ft_isdigit(value[i]) && i < 9)
+		size = size * 10 + value[i++] - '0';
+	shift = 0;
+	if (value[i] == 'k' || value[i] == 'K')
+		shift = 10;
+	else if (value[i] == 'm' || value[i] == 'M')
+		shift = 20;
+	if (shift)
+		i++;
+	if (value[i])
+		return (0);
+	return (size << shift);
+}
+
+/**
+ * @brief Returns the largest pipe size the kernel hands out.
+ * 
+ * The limit is read once from `/proc/sys/fs/pipe-max-size`; when it 
+ * cannot be read, the kernel's default limit is assumed.
+ * 
+ * @return The maximum pipe size in bytes.
+ */
+static long	pipe_max_size(void)
+{
+	static long	max;
+	char		buf[24];
+	ssize_t		len;
+	int			fd;
+
+	if (max > 0)
+		return (max);
+	len = -1;
+	fd = open(PIPE_MAX_PATH, O_RDONLY | O_CLOEXEC);
+	if (fd >= 0)
+	{
+		len = read(fd, buf, sizeof(buf) - 1);
+		close(fd);
+	}
+	if (len > 0)
+	{
+		buf[len] = '\0';
+		max = ft_atoi(buf);
+	}
+	if (max <= 0)
+		max = PIPE_MAX_DEFAULT;
+	return (max);
+}
+
+/**
+ * @brief Returns the pipe size requested for the pipelines.
+ * 
+ * The size is read from the `PIPE_SIZE` variable when a pipeline starts, 
+ * so producer and consumer stages that move a lot of data can get larger 
+ * pipes and switch less often. It is capped at the system's maximum pipe 
+ * size.
+ * 
+ * @param ms A pointer to the main shell structure.
+ * 
+ * @return The size in bytes, or 0 to keep the default.
+ */
+int	pipe_size_setting(t_ms *ms)
+{
+	long	size;
+
+	size = parse_pipe_size(get_env_value(PIPE_SIZE_VAR, ms));
+	if (size <= 0)
+		return (0);
+	if (size > pipe_max_size())
+		size = pipe_max_size();
+	return ((int)size);
+}
+
+#ifdef F_SETPIPE_SZ
+
+/**
+ * @brief Creates the pipe to the next stage of a pipeline.
+ * 
+ * The pipe gets the size of `PIPE_SIZE`, if one was set. The kernel 
+ * rounds it up to a whole number of pages; when it refuses, for instance 
+ * because the user is over its pipe quota, the default size is kept.
+ * 
+ * @param p The pipe structure of the running pipeline.
+ * 
+ * @return 0 on success, -1 if the pipe could not be created.
+ */
+int	open_pipe(t_pipe *p)
+{
+	if (pipe(p->fd) == -1)
+		return (-1);
+	if (p->pipe_size > 0)
+		fcntl(p->fd[1], F_SETPIPE_SZ, p->pipe_size);
+	return (0);
+}
+
+#else
+
+/**
+ * @brief Creates the pipe to the next stage of a pipeline.
+ * 
+ * Without `F_SETPIPE_SZ` the size cannot be changed and `PIPE_SIZE` is 
+ * ignored.
+ * 
+ * @param p The pipe structure of the running pipeline.
+ * 
+ * @return 0 on success, -1 if the pipe could not be created.
+ */
+int	open_pipe(t_pipe *p)
+{
+	return (pipe(p->fd));
+}
+
+#endif
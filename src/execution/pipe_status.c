@@ -0,0 +1,133 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   pipe_status.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: agent <agent@local>                        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 02:12:20 by agent             #+#    #+#             */
+/*   Updated: 2026/10/17 03:16:31 by agent            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../include/minishell.h"
+
+/**
+ * @brief Adds the CPU time of a reaped child to the pipeline timer.
+ * 
+ * @param timer A pointer to the timer of `time`.
+ * @param ru The resource usage of the child.
+ */
+static void	add_usage(t_timer *timer, struct rusage *ru)
+{
+	timer->user += ru->ru_utime.tv_sec * 1000000LL + ru->ru_utime.tv_usec;
+	timer->sys += ru->ru_stime.tv_sec * 1000000LL + ru->ru_stime.tv_usec;
+}
+
+/**
+ * @brief Reaps the children of a pipeline and sets the exit status.
+ * 
+ * The exit status of the shell is the one of the last stage. A newline is 
+ * printed for every child killed by `SIGINT`, and "Quit" when the last 
+ * stage was killed by `SIGQUIT`, like bash does. The CPU time of every 
+ * child goes to the timer of `time`, and the wait for each child is traced.
+ * 
+ * @param kids The child table of the pipeline.
+ * @param n The number of stages.
+ * @param ms A pointer to the main shell structure.
+ */
+void	finish_children(t_child *kids, int n, t_ms *ms)
+{
+	int			i;
+	long long	start;
+
+	start = trace_begin(ms);
+	reap_children(kids, n);
+	trace_wait(ms, start, kids, n);
+	i = 0;
+	while (i < n)
+	{
+		if (kids[i].signal == SIGINT)
+			write(STDERR_FILENO, "\n", 1);
+		add_usage(&ms->timer, &kids[i].usage);
+		i++;
+	}
+	ms->exit_status = kids[n - 1].status;
+	if (kids[n - 1].signal == SIGQUIT)
+		write(STDERR_FILENO, "Quit\n", 5);
+}
+
+/**
+ * @brief Waits for the child of a simple command and sets the exit status.
+ * 
+ * @param pid The pid of the child.
+ * @param ms A pointer to the main shell structure.
+ */
+void	finish_child(pid_t pid, t_ms *ms)
+{
+	t_child	child;
+
+	child_watch(&child, pid);
+	finish_children(&child, 1, ms);
+}
+
+/**
+ * @brief Appends a non-negative exit code in decimal to a builder.
+ * 
+ * @param sb A pointer to the string builder.
+ * @param code The exit code to append.
+ * @param ms A pointer to the main shell structure.
+ * 
+ * @return `1` on success, `0` if memory allocation fails.
+ */
+static int	append_code(t_strbuf *sb, int code, t_ms *ms)
+{
+	char	digits[12];
+	int		i;
+
+	i = 12;
+	digits[--i] = '0' + code % 10;
+	code /= 10;
+	while (code > 0)
+	{
+		digits[--i] = '0' + code % 10;
+		code /= 10;
+	}
+	return (sb_append(sb, digits + i, 12 - i, ms));
+}
+
+/**
+ * @brief Records the exit code of every stage for `$PIPESTATUS`.
+ * 
+ * The codes are stored space separated in `ms->pipestatus`, in pipeline 
+ * order, so `$PIPESTATUS` expands to one word per stage. Without a child 
+ * table, the exit status of the simple command that just ran is stored.
+ * 
+ * @param kids The child table of the pipeline, or NULL.
+ * @param n The number of stages.
+ * @param ms A pointer to the main shell structure.
+ */
+void	record_pipestatus(t_child *kids, int n, t_ms *ms)
+{
+	int	i;
+
+	if (ms->pipestatus.buf)
+	{
+		ms->pipestatus.len = 0;
+		ms->pipestatus.buf[0] = '\0';
+	}
+	if (!kids)
+	{
+		append_code(&ms->pipestatus, ms->exit_status, ms);
+		return ;
+	}
+	i = 0;
+	while (i < n)
+	{
+		if (i > 0 && !sb_putc(&ms->pipestatus, ' ', ms))
+			return ;
+		if (!append_code(&ms->pipestatus, kids[i].status, ms))
+			return ;
+		i++;
+	}
+}
@@ -0,0 +1,186 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   pump_stage.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: agent <agent@local>                        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 02:51:06 by agent             #+#    #+#             */
+/*   Updated: 2026/10/17 03:35:26 by agent            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../include/minishell.h"
+
+/**
+ * @brief Checks that every operand of `cat` names a regular file.
+ * 
+ * Options, `-` and anything that could block, like a FIFO or a terminal, 
+ * are left to the real `cat`: the shell blocks `SIGINT` while it pumps, so 
+ * it must never wait on an input nobody can interrupt.
+ * 
+ * @param args The operands, after the command name.
+ * 
+ * @return 1 if all operands are regular files, 0 otherwise.
+ */
+static int	operands_are_files(char **args)
+{
+	struct stat	st;
+
+	while (*args)
+	{
+		if ((*args)[0] == '-' || stat(*args, &st) != 0
+			|| !S_ISREG(st.st_mode))
+			return (0);
+		args++;
+	}
+	return (1);
+}
+
+/**
+ * @brief Checks whether a pipeline stage can be pumped by the shell.
+ * 
+ * Only a plain `cat` of files qualifies, in a foreground pipeline and not 
+ * as the last stage, with its output going to the pipe. Without operands 
+ * it copies its input, which must then be the previous stage, a heredoc 
+ * or a regular file. One stage per pipeline at most is pumped, and the 
+ * `cat` found in `PATH` must be the system one, `SYSTEM_CAT`, compared by 
+ * device and inode so a link to it counts. A missing `cat`, or another 
+ * program called `cat` earlier in `PATH`, is forked and runs as before.
+ * 
+ * @param cur The command of the current stage.
+ * @param p The pipe structure of the running pipeline.
+ * 
+ * @return 1 if the stage may be pumped, 0 if it must be forked.
+ */
+static int	is_pump_stage(t_cmd *cur, t_pipe *p)
+{
+	struct stat	st;
+	struct stat	sys;
+	char		*path;
+	int			ok;
+
+	if (p->pump.cmd || p->ms->jobs.background || !cur->name
+		|| p->cmd_num >= p->num_cmds - 1 || ft_strcmp(cur->name, "cat")
+		|| cur->infile == NO_FD || cur->outfile != DEF
+		|| !operands_are_files(cur->args + 1))
+		return (0);
+	if (!cur->args[1] && cur->infile == DEF && p->cmd_num == 0)
+		return (0);
+	if (!cur->args[1] && cur->infile != DEF && !cur->heredoc
+		&& (fstat(cur->infile, &st) != 0 || !S_ISREG(st.st_mode)))
+		return (0);
+	path = resolve_cmd_path(cur->name, p->ms);
+	ok = (path && stat(path, &st) == 0 && stat(SYSTEM_CAT, &sys) == 0
+			&& st.st_dev == sys.st_dev && st.st_ino == sys.st_ino);
+	free(path);
+	return (ok);
+}
+
+/**
+ * @brief Sets a `cat` stage aside to be pumped by the shell.
+ * 
+ * Instead of forking `cat`, the shell creates the pipe to the next stage 
+ * and keeps its write end, together with the input of the stage, until 
+ * every stage has started; `run_pump` then moves the data. Both ends are 
+ * closed on `exec`, so the other stages never hold them open. An input 
+ * the stage does not read is closed right away, which lets the previous 
+ * stage see the reader go, as it would with `cat`.
+ * 
+ * @param cur The command of the current stage.
+ * @param p The pipe structure of the running pipeline.
+ * 
+ * @return 1 if the stage was set aside, 0 if it must be forked.
+ */
+int	defer_pump(t_cmd *cur, t_pipe *p)
+{
+	if (!is_pump_stage(cur, p) || open_pipe(p) == -1)
+		return (0);
+	p->pump.cmd = cur;
+	p->pump.stage = p->cmd_num;
+	p->pump.in = p->cur_fd;
+	p->pump.out = p->fd[1];
+	fcntl(p->pump.out, F_SETFD, FD_CLOEXEC);
+	if (cur->args[1] || cur->infile != DEF)
+	{
+		close_file(p->pump.in);
+		p->pump.in = -1;
+	}
+	else
+		fcntl(p->pump.in, F_SETFD, FD_CLOEXEC);
+	p->cur_fd = p->fd[0];
+	return (1);
+}
+
+/**
+ * @brief Pumps every input of the deferred `cat` stage.
+ * 
+ * Like `cat`, it goes on after an operand that cannot be read and stops 
+ * once the reader is gone.
+ * 
+ * @param pump The deferred stage.
+ * 
+ * @return The exit status of the stage.
+ */
+static int	pump_all(t_pump *pump)
+{
+	char	**args;
+	int		status;
+	int		ret;
+
+	args = pump->cmd->args + 1;
+	if (!*args && pump->cmd->infile != DEF)
+		return (pump_file("-", pump->cmd->infile, pump->out));
+	if (!*args)
+		return (pump_file("-", pump->in, pump->out));
+	status = 0;
+	while (*args && status != 128 + SIGPIPE)
+	{
+		ret = pump_file(*args++, -1, pump->out);
+		if (ret > status)
+			status = ret;
+	}
+	return (status);
+}
+
+/**
+ * @brief Runs the deferred `cat` stage of a pipeline, if there is one.
+ * 
+ * Called once every stage has started, so the next stage is already 
+ * reading. `SIGPIPE` is ignored meanwhile, so a reader that exits early 
+ * turns into an `EPIPE` instead of killing the shell. `SIGINT` is blocked, 
+ * as the copy runs in the shell itself: Ctrl+C reaches the other stages, 
+ * the pump stops once its reader is gone, and the pending signal is taken 
+ * as the stage's status, 130. The status goes to the stage's entry in the 
+ * child table, which has no pid to wait for, and the pump's descriptors are 
+ * closed so the next stage sees the end of its input.
+ * 
+ * @param p The pipe structure of the running pipeline.
+ */
+void	run_pump(t_pipe *p)
+{
+	struct sigaction	ign;
+	struct sigaction	old;
+	sigset_t			intr;
+	sigset_t			pending;
+	int					sig;
+
+	if (!p->pump.cmd)
+		return ;
+	ft_memset(&ign, 0, sizeof(ign));
+	ign.sa_handler = SIG_IGN;
+	sigaction(SIGPIPE, &ign, &old);
+	sigemptyset(&intr);
+	sigaddset(&intr, SIGINT);
+	sigprocmask(SIG_BLOCK, &intr, NULL);
+	p->stages[p->pump.stage].status = pump_all(&p->pump);
+	if (sigpending(&pending) == 0 && sigismember(&pending, SIGINT)
+		&& sigwait(&intr, &sig) == 0)
+		p->stages[p->pump.stage].status = 128 + SIGINT;
+	sigprocmask(SIG_UNBLOCK, &intr, NULL);
+	sigaction(SIGPIPE, &old, NULL);
+	close_two_fds(p->pump.in, p->pump.out);
+	p->pump.cmd = NULL;
+	p->pump.in = -1;
+	p->pump.out = -1;
+}
@@ -0,0 +1,127 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   reap.c                                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: agent <agent@local>                        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 02:12:20 by agent             #+#    #+#             */
+/*   Updated: 2026/10/17 03:16:31 by agent            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <sys/syscall.h>
+#include "../../include/minishell.h"
+
+#ifdef SYS_pidfd_open
+
+/**
+ * @brief Opens a process file descriptor for a child.
+ * 
+ * The descriptor becomes readable when the child terminates, which lets 
+ * the reaper wait for exactly the children it started. It is opened with 
+ * the close-on-exec flag, so commands never inherit it.
+ * 
+ * @param pid The pid of the child.
+ * 
+ * @return The pidfd, or -1 if the kernel does not support pidfds.
+ */
+static int	open_pidfd(pid_t pid)
+{
+	return ((int)syscall(SYS_pidfd_open, pid, 0));
+}
+
+#else
+
+/**
+ * @brief Opens a process file descriptor for a child.
+ * 
+ * Without `pidfd_open` every child is reaped with a blocking `waitpid`.
+ * 
+ * @param pid The pid of the child.
+ * 
+ * @return Always -1.
+ */
+static int	open_pidfd(pid_t pid)
+{
+	(void)pid;
+	return (-1);
+}
+
+#endif
+
+/**
+ * @brief Allocates the child table of a pipeline.
+ * 
+ * Each stage gets one entry. Entries start out as finished stages without 
+ * a process, so a pipeline that stops early never waits for stages that 
+ * were not started.
+ * 
+ * @param n The number of stages.
+ * @param ms A pointer to the main shell structure.
+ * 
+ * @return The table, or NULL if memory allocation fails.
+ */
+t_child	*children_new(int n, t_ms *ms)
+{
+	t_child	*kids;
+	int		i;
+
+	kids = (t_child *)malloc(n * sizeof(t_child));
+	if (!kids)
+		return (print_malloc_set_status(ms));
+	i = 0;
+	while (i < n)
+	{
+		kids[i].pid = 0;
+		kids[i].pidfd = -1;
+		kids[i].status = 0;
+		kids[i].signal = 0;
+		kids[i].done = true;
+		kids[i].reaped = 0;
+		ft_memset(&kids[i].usage, 0, sizeof(struct rusage));
+		i++;
+	}
+	return (kids);
+}
+
+/**
+ * @brief Registers a started child in its table entry.
+ * 
+ * @param c The entry of the stage the child runs.
+ * @param pid The pid of the child.
+ */
+void	child_watch(t_child *c, pid_t pid)
+{
+	c->pid = pid;
+	c->pidfd = open_pidfd(pid);
+	c->status = 0;
+	c->signal = 0;
+	c->done = false;
+	c->reaped = 0;
+	ft_memset(&c->usage, 0, sizeof(struct rusage));
+}
+
+/**
+ * @brief Closes the pidfds still held by a child table.
+ * 
+ * This is only needed when a pipeline is abandoned before its children 
+ * are reaped; `reap_children` closes each pidfd as soon as the child is 
+ * collected.
+ * 
+ * @param kids The child table.
+ * @param n The number of entries in the table.
+ */
+void	children_release(t_child *kids, int n)
+{
+	int	i;
+
+	i = 0;
+	while (kids && i < n)
+	{
+		if (kids[i].pidfd >= 0)
+			close(kids[i].pidfd);
+		kids[i].pidfd = -1;
+		i++;
+	}
+}
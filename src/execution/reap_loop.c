@@ -0,0 +1,179 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   reap_loop.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: agent <agent@local>                        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 02:12:20 by agent             #+#    #+#             */
+/*   Updated: 2026/10/17 03:16:31 by agent            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <poll.h>
+#include <errno.h>
+#include "../../include/minishell.h"
+
+/**
+ * @brief Collects the status of one child.
+ * 
+ * The child is waited for by pid with `wait4`, so children that belong to 
+ * something else are never reaped by accident, and its resource usage is kept 
+ * for `time`. A child killed by a signal gets the usual `128 + signal` exit 
+ * code. The pidfd of the child is closed and the time it was collected is 
+ * kept for the tracer.
+ * 
+ * @param c The table entry of the child.
+ * @param options The `wait4` options, `WNOHANG` to only check the child.
+ * 
+ * @return 1 if the child was collected, 0 if it is still running.
+ */
+static int	collect_child(t_child *c, int options)
+{
+	int		status;
+	pid_t	ret;
+
+	status = 0;
+	ret = wait4(c->pid, &status, options, &c->usage);
+	while (ret < 0 && errno == EINTR)
+		ret = wait4(c->pid, &status, options, &c->usage);
+	if (ret == 0)
+		return (0);
+	if (ret == c->pid && WIFEXITED(status))
+		c->status = WEXITSTATUS(status);
+	if (ret == c->pid && WIFSIGNALED(status))
+	{
+		c->signal = WTERMSIG(status);
+		c->status = 128 + c->signal;
+	}
+	if (c->pidfd >= 0)
+		close(c->pidfd);
+	c->pidfd = -1;
+	c->done = true;
+	c->reaped = trace_now();
+	return (1);
+}
+
+/**
+ * @brief Fills the poll entries for the children that are still running.
+ * 
+ * @param kids The child table.
+ * @param n The number of entries in the table.
+ * @param fds Scratch space for `n` poll entries.
+ * 
+ * @return The number of entries filled.
+ */
+static int	fill_polls(t_child *kids, int n, struct pollfd *fds)
+{
+	int	i;
+	int	cnt;
+
+	i = 0;
+	cnt = 0;
+	while (i < n)
+	{
+		if (!kids[i].done && kids[i].pidfd >= 0)
+		{
+			fds[cnt].fd = kids[i].pidfd;
+			fds[cnt].events = POLLIN;
+			fds[cnt++].revents = 0;
+		}
+		i++;
+	}
+	return (cnt);
+}
+
+/**
+ * @brief Waits for the next children of the table to terminate.
+ * 
+ * The pidfds of all running children are polled together and every child 
+ * whose pidfd became readable is collected. Children are therefore reaped 
+ * in the order they finish, whatever their position in the pipeline. A 
+ * signal interrupting the poll simply starts a new round.
+ * 
+ * @param kids The child table.
+ * @param n The number of entries in the table.
+ * @param fds Scratch space for `n` poll entries.
+ * 
+ * @return The number of children that were still running before the call, 
+ *         or 0 once nothing is left to poll or `poll` fails.
+ */
+static int	poll_round(t_child *kids, int n, struct pollfd *fds)
+{
+	int	i;
+	int	cnt;
+
+	cnt = fill_polls(kids, n, fds);
+	if (cnt == 0 || (poll(fds, cnt, -1) < 0 && errno != EINTR))
+		return (0);
+	i = 0;
+	cnt = 0;
+	while (i < n)
+	{
+		if (!kids[i].done && kids[i].pidfd >= 0)
+		{
+			if (fds[cnt++].revents)
+				collect_child(&kids[i], 0);
+		}
+		i++;
+	}
+	return (cnt);
+}
+
+/**
+ * @brief Reaps every child of a table.
+ * 
+ * Children with a pidfd are collected by the poll loop as they finish. 
+ * The remaining ones, whose pidfd could not be opened or when the poll 
+ * entries cannot be allocated, are waited for one by one by pid. When 
+ * the function returns, the status of every stage is in the table.
+ * 
+ * @param kids The child table.
+ * @param n The number of entries in the table.
+ */
+void	reap_children(t_child *kids, int n)
+{
+	struct pollfd	*fds;
+	int				running;
+	int				i;
+
+	fds = (struct pollfd *)malloc(n * sizeof(struct pollfd));
+	running = (fds != NULL);
+	while (running)
+		running = poll_round(kids, n, fds);
+	free(fds);
+	i = 0;
+	while (i < n)
+	{
+		if (!kids[i].done)
+			collect_child(&kids[i], 0);
+		i++;
+	}
+}
+
+/**
+ * @brief Collects the children of a table that have already finished.
+ * 
+ * Nothing blocks: each running child is checked with `WNOHANG`. This is 
+ * how background jobs are reaped while the shell keeps reading commands.
+ * 
+ * @param kids The child table.
+ * @param n The number of entries in the table.
+ * 
+ * @return The number of children still running.
+ */
+int	children_poll(t_child *kids, int n)
+{
+	int	i;
+	int	running;
+
+	i = 0;
+	running = 0;
+	while (i < n)
+	{
+		if (!kids[i].done && !collect_child(&kids[i], WNOHANG))
+			running++;
+		i++;
+	}
+	return (running);
+}
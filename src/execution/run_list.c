@@ -0,0 +1,160 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   run_list.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: agent <agent@local>                        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 02:24:25 by agent             #+#    #+#             */
+/*   Updated: 2026/10/17 03:16:31 by agent            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../include/minishell.h"
+
+/**
+ * @brief Runs the pipelines of an and-or list.
+ * 
+ * A pipeline after `&&` runs only if the exit status is 0 and one after 
+ * `||` only if it is not. A skipped pipeline leaves the status alone, so 
+ * `false && a || b` runs `b`, as in bash.
+ * 
+ * @param ms A pointer to the main shell structure.
+ * @param item The and-or list.
+ * 
+ * @return 1 if the line may go on, 0 if it must stop.
+ */
+static int	run_and_or(t_ms *ms, t_node *item)
+{
+	t_node	*node;
+
+	node = item->body;
+	while (node)
+	{
+		if (node->op == EMPTY || (node->op == AND_IF && ms->exit_status == 0)
+			|| (node->op == OR_IF && ms->exit_status != 0))
+		{
+			if (!run_pipeline(ms, node))
+				return (0);
+		}
+		node = node->next;
+	}
+	return (1);
+}
+
+/**
+ * @brief Runs an and-or list in the forked child of a background job.
+ * 
+ * The child leads the job's process group, reads from `/dev/null` and runs 
+ * the list as a foreground shell would, then exits with its status.
+ * 
+ * @param ms A pointer to the main shell structure.
+ * @param item The and-or list.
+ */
+static void	run_subshell(t_ms *ms, t_node *item)
+{
+	int	fd;
+	int	status;
+
+	job_setpgid(ms, 0);
+	ms->jobs.background = false;
+	fd = open(DEV_NULL, O_RDONLY);
+	if (fd >= 0)
+	{
+		dup2(fd, STDIN_FILENO);
+		close(fd);
+	}
+	run_and_or(ms, item);
+	status = ms->exit_status;
+	if (status == MALLOC_ERR || status == SYSTEM_ERR)
+		status = 1;
+	clean_in_child(ms);
+	exit(status);
+}
+
+/**
+ * @brief Forks a child shell for a background and-or list.
+ * 
+ * @param ms A pointer to the main shell structure.
+ * @param item The and-or list.
+ * 
+ * @return 1 if the line may go on, 0 if it must stop.
+ */
+static int	fork_subshell(t_ms *ms, t_node *item)
+{
+	pid_t	pid;
+
+	pid = fork();
+	if (pid < 0)
+	{
+		perror("fork failed");
+		ms->exit_status = SYSTEM_ERR;
+		return (0);
+	}
+	job_setpgid(ms, pid);
+	if (pid == 0)
+		run_subshell(ms, item);
+	job_add_pid(ms, pid);
+	return (ms->exit_status != MALLOC_ERR);
+}
+
+/**
+ * @brief Starts an and-or list ended by `&` as a background job.
+ * 
+ * A single pipeline runs like a foreground one with `ms->jobs.background` 
+ * set, so its processes form the job. A list with `&&` or `||` has to 
+ * decide as it goes, so a child shell runs it and the child is the job. A 
+ * timed pipeline also runs in a child shell, which reports its times when 
+ * it finishes, as in bash.
+ * 
+ * @param ms A pointer to the main shell structure.
+ * @param item The and-or list.
+ * 
+ * @return 1 if the line may go on, 0 if it must stop.
+ */
+static int	run_background(t_ms *ms, t_node *item)
+{
+	int	go_on;
+
+	free(ms->jobs.line);
+	ms->jobs.line = list_text(ms, item);
+	if (!ms->jobs.line)
+	{
+		print_malloc_set_status(ms);
+		return (0);
+	}
+	ms->jobs.background = true;
+	ms->jobs.pgid = 0;
+	if (item->body->next || item->body->timed)
+		go_on = fork_subshell(ms, item);
+	else
+		go_on = run_pipeline(ms, item->body);
+	ms->jobs.background = false;
+	return (go_on);
+}
+
+/**
+ * @brief Runs the command list of a line.
+ * 
+ * The and-or lists run one after the other; those ended by `&` are started 
+ * in the background and the next one follows at once. A fatal error stops 
+ * the line.
+ * 
+ * @param ms A pointer to the main shell structure.
+ */
+void	run_list(t_ms *ms)
+{
+	t_node	*item;
+	int		go_on;
+
+	item = ms->line.list;
+	go_on = 1;
+	while (item && go_on)
+	{
+		if (item->op == BACKGROUND)
+			go_on = run_background(ms, item);
+		else
+			go_on = run_and_or(ms, item);
+		item = item->next;
+	}
+}
@@ -0,0 +1,157 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   run_pipeline.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: agent <agent@local>                        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 02:24:25 by agent             #+#    #+#             */
+/*   Updated: 2026/10/17 02:31:20 by agent            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../include/minishell.h"
+
+/**
+ * @brief Executes a list of commands.
+ * 
+ * This function processes a list of commands, determining whether to execute 
+ * them as built-in functions or external commands. It handles the execution 
+ * of a single command or multiple commands by creating child processes as 
+ * needed.
+ * 
+ * If there is only one command and it is a built-in, it will be executed 
+ * directly, unless the line runs in the background: then it is forked like any 
+ * other command and the line reads from `/dev/null`. If there are multiple 
+ * commands, child processes will be created for each command to execute them 
+ * in parallel. After executing the commands, it ensures file descriptors are 
+ * closed and handles the appropriate exit statuses; a simple command also sets 
+ * `$PIPESTATUS` to its exit status.
+ * 
+ * @param ms A pointer to the shell's main structure containing the command 
+ *           list and other relevant state information.
+ */
+static void	execute_commands(t_ms *ms)
+{
+	t_cmd	*cur;
+	int		i;
+
+	cur = ms->cmds;
+	i = 0;
+	while (cur)
+	{
+		cur = cur->next;
+		i++;
+	}
+	if (ms->jobs.background)
+		job_detach_stdin(ms->cmds);
+	if (is_builtin(ms->cmds) && if_children_needed(ms->cmds) == false && i == 1
+		&& !ms->jobs.background)
+		handle_builtin(ms->cmds, ms);
+	else
+	{
+		if (i == 1)
+			make_one_child(ms->cmds, ms);
+		else
+			make_multiple_children(i, ms->cmds, ms);
+	}
+	if (i == 1)
+		record_pipestatus(NULL, 1, ms);
+	close_every_cmds_fds(ms->cmds);
+}
+
+/**
+ * @brief Loads the tokens of one pipeline into `ms->tokens`.
+ * 
+ * The raw tokens of the pipeline are copied out of the line, as finishing 
+ * rewrites and compacts them in place and the blocks index `ms->tokens` 
+ * from the start. Words are then expanded and joined and redirection files 
+ * attached.
+ * 
+ * @param ms A pointer to the main shell structure.
+ * @param node The pipeline node.
+ * 
+ * @return 1 on success, 0 if an allocation fails.
+ */
+static int	load_pipeline(t_ms *ms, t_node *node)
+{
+	size_t		n;
+	long long	start;
+
+	start = trace_begin(ms);
+	n = node->end - node->start;
+	clean_token_list(&ms->tokens);
+	if (!tokens_reserve(&ms->tokens, n))
+	{
+		print_malloc_set_status(ms);
+		return (0);
+	}
+	ft_memcpy(ms->tokens.arr, ms->line.toks.arr + node->start,
+		n * sizeof(t_token));
+	ms->tokens.len = n;
+	if (!finish_tokens(&ms->tokens, ms))
+	{
+		clean_token_list(&ms->tokens);
+		ft_putstr_fd(TOKENS_ERR, STDERR_FILENO);
+		return (0);
+	}
+	trace_end(ms, "expand", start, 0);
+	return (1);
+}
+
+/**
+ * @brief Releases what one pipeline used.
+ * 
+ * The tokens, blocks and commands live in the line arena, which is only 
+ * reset after the whole line; here the lists are emptied, the command 
+ * descriptors closed and the pipeline's heredocs dropped.
+ * 
+ * @param ms A pointer to the main shell structure.
+ */
+static void	clean_pipeline(t_ms *ms)
+{
+	clean_token_list(&ms->tokens);
+	clean_block_list(&(ms->blocks));
+	clean_cmd_list(&(ms->cmds));
+	reset_heredocs(ms);
+}
+
+/**
+ * @brief Runs one pipeline of a command list.
+ * 
+ * The pipeline is expanded, its commands are built, which reads its 
+ * heredocs, and it is executed; each phase is traced. A pipeline after 
+ * the `time` reserved word is timed and its times reported. A heredoc 
+ * interrupted by Ctrl-C or a failed allocation stops the rest of the line.
+ * 
+ * @param ms A pointer to the main shell structure.
+ * @param node The pipeline node.
+ * 
+ * @return 1 if the line may go on, 0 if it must stop.
+ */
+int	run_pipeline(t_ms *ms, t_node *node)
+{
+	long long	start;
+
+	if (node->timed)
+		timer_start(ms);
+	if (!load_pipeline(ms, node))
+		return (0);
+	start = trace_begin(ms);
+	if (!create_blocks_and_cmds_lists(ms))
+		return (0);
+	trace_end(ms, "build", start, 0);
+	if (g_sgnl == SIGINT)
+	{
+		clean_pipeline(ms);
+		g_sgnl = 0;
+		return (0);
+	}
+	start = trace_begin(ms);
+	execute_commands(ms);
+	trace_end(ms, "exec", start, 0);
+	clean_pipeline(ms);
+	if (node->timed)
+		timer_report(ms, node->timed);
+	return (ms->exit_status != MALLOC_ERR && ms->exit_status != SYSTEM_ERR);
+}
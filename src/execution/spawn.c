@@ -0,0 +1,194 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   spawn.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: agent <agent@local>                        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 01:06:24 by agent             #+#    #+#             */
+/*   Updated: 2026/10/17 03:05:02 by agent            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../include/minishell.h"
+
+/**
+ * @brief Finds the executable a command can be spawned with directly.
+ * 
+ * Only commands that would be executed without any error are launched 
+ * through `posix_spawn`: the file must exist, must not be a directory and 
+ * must be executable. Everything else (builtins, missing commands, 
+ * permission problems) is left to the forked child, which already prints 
+ * the right message and exits with the right status.
+ * 
+ * @param cmd A pointer to the command to launch.
+ * @param ms A pointer to the main shell structure.
+ * 
+ * @return A newly allocated path to execute, or NULL if the command has to 
+ *         go through the fork path.
+ */
+static char	*spawn_path(t_cmd *cmd, t_ms *ms)
+{
+	char		*path;
+	struct stat	st;
+
+	if (!cmd->name || !cmd->name[0] || is_builtin(cmd))
+		return (NULL);
+	if (ft_strchr(cmd->name, '/') || cmd->name[0] == '.'
+		|| !get_env_value("PATH", ms))
+		path = ft_strdup(cmd->name);
+	else
+		path = resolve_cmd_path(cmd->name, ms);
+	if (!path)
+		return (NULL);
+	if (stat(path, &st) != 0 || S_ISDIR(st.st_mode)
+		|| access(path, X_OK) != 0)
+	{
+		free(path);
+		return (NULL);
+	}
+	return (path);
+}
+
+/**
+ * @brief Queues a `dup2` or a `close` on the spawn file actions.
+ * 
+ * @param fa A pointer to the file actions of the process to spawn.
+ * @param fd The descriptor to act on; negative values are skipped.
+ * @param target The descriptor to duplicate `fd` onto, or -1 to close `fd`.
+ * 
+ * @return 0 on success, or an error number if the action could not be added.
+ */
+static int	add_fd_action(posix_spawn_file_actions_t *fa, int fd, int target)
+{
+	if (fd < 0)
+		return (0);
+	if (target < 0)
+		return (posix_spawn_file_actions_addclose(fa, fd));
+	return (posix_spawn_file_actions_adddup2(fa, fd, target));
+}
+
+/**
+ * @brief Describes the pipe and redirection setup of a command as spawn 
+ *        file actions.
+ * 
+ * The actions mirror what `setup_pipes`, `redirect_process` and the fd 
+ * cleanup do in a forked child: the pipe ends are duplicated onto the 
+ * standard streams first, the command's own redirections override them, and 
+ * finally every pipe end and every command fd is closed.
+ * 
+ * @param fa A pointer to the file actions to fill.
+ * @param cur A pointer to the command to launch.
+ * @param cmds A pointer to the first command of the line.
+ * @param p A pointer to the pipeline state, or NULL for a single command.
+ * 
+ * @return 1 if all actions were added, 0 otherwise.
+ */
+static int	add_redirect_actions(posix_spawn_file_actions_t *fa, t_cmd *cur,
+	t_cmd *cmds, t_pipe *p)
+{
+	int	err;
+
+	err = 0;
+	if (p && p->cmd_num > 0)
+		err |= add_fd_action(fa, p->cur_fd, STDIN_FILENO);
+	if (p && p->cmd_num < p->num_cmds - 1)
+		err |= add_fd_action(fa, p->fd[1], STDOUT_FILENO);
+	if (cur->infile != DEF)
+		err |= add_fd_action(fa, cur->infile, STDIN_FILENO);
+	if (cur->outfile != DEF)
+		err |= add_fd_action(fa, cur->outfile, STDOUT_FILENO);
+	if (p)
+	{
+		err |= add_fd_action(fa, p->fd[0], -1);
+		err |= add_fd_action(fa, p->fd[1], -1);
+		err |= add_fd_action(fa, p->cur_fd, -1);
+	}
+	while (cmds)
+	{
+		err |= add_fd_action(fa, cmds->infile, -1);
+		err |= add_fd_action(fa, cmds->outfile, -1);
+		cmds = cmds->next;
+	}
+	return (err == 0);
+}
+
+/**
+ * @brief Spawns the process with `SIGINT` and `SIGQUIT` reset to default.
+ * 
+ * A process of a background job is placed in the job's process group.
+ * 
+ * @param path The executable to run.
+ * @param cur A pointer to the command whose arguments are passed on.
+ * @param fa A pointer to the prepared file actions.
+ * @param ms A pointer to the main shell structure holding the environment.
+ * 
+ * @return The pid of the new process, or 0 if it could not be spawned.
+ */
+static pid_t	run_spawn(char *path, t_cmd *cur,
+	posix_spawn_file_actions_t *fa, t_ms *ms)
+{
+	posix_spawnattr_t	attr;
+	sigset_t			sigs;
+	pid_t				pid;
+	char				**envp;
+	short				flags;
+
+	envp = env_snapshot(ms);
+	if (!envp || posix_spawnattr_init(&attr) != 0)
+		return (0);
+	sigemptyset(&sigs);
+	sigaddset(&sigs, SIGINT);
+	sigaddset(&sigs, SIGQUIT);
+	posix_spawnattr_setsigdefault(&attr, &sigs);
+	flags = POSIX_SPAWN_SETSIGDEF;
+	if (ms->jobs.background)
+	{
+		flags |= POSIX_SPAWN_SETPGROUP;
+		posix_spawnattr_setpgroup(&attr, ms->jobs.pgid);
+	}
+	posix_spawnattr_setflags(&attr, flags);
+	if (posix_spawn(&pid, path, fa, &attr, cur->args, envp) != 0)
+		pid = 0;
+	posix_spawnattr_destroy(&attr);
+	return (pid);
+}
+
+/**
+ * @brief Launches an external command with `posix_spawn` instead of `fork`.
+ * 
+ * The C library starts the process with a `vfork`-style clone, so the 
+ * shell's memory (history, environment, token lists) is never copied. The 
+ * pipe and redirection fds are set up through file actions. Whenever the 
+ * command cannot be spawned cleanly, 0 is returned and the caller falls 
+ * back to `fork`, which covers builtins and every error case.
+ * 
+ * @param cur A pointer to the command to launch.
+ * @param cmds A pointer to the first command of the line.
+ * @param p A pointer to the pipeline state, or NULL for a single command.
+ * @param ms A pointer to the main shell structure.
+ * 
+ * @return The pid of the spawned process, or 0 if the caller has to fork.
+ */
+pid_t	spawn_command(t_cmd *cur, t_cmd *cmds, t_pipe *p, t_ms *ms)
+{
+	posix_spawn_file_actions_t	fa;
+	char						*path;
+	pid_t						pid;
+
+	if (!cur->args || !cur->args[0]
+		|| cur->infile == NO_FD || cur->outfile == NO_FD)
+		return (0);
+	path = spawn_path(cur, ms);
+	if (!path)
+		return (0);
+	pid = 0;
+	if (posix_spawn_file_actions_init(&fa) == 0)
+	{
+		if (add_redirect_actions(&fa, cur, cmds, p))
+			pid = run_spawn(path, cur, &fa, ms);
+		posix_spawn_file_actions_destroy(&fa);
+	}
+	free(path);
+	return (pid);
+}
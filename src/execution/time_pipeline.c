@@ -0,0 +1,136 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   time_pipeline.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: agent <agent@local>                        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 02:31:20 by agent             #+#    #+#             */
+/*   Updated: 2026/10/17 02:31:20 by agent            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../include/minishell.h"
+
+/**
+ * @brief Converts a `timeval` to microseconds.
+ * 
+ * @param tv The time value.
+ * 
+ * @return The time in microseconds.
+ */
+static long long	tv_usec(struct timeval tv)
+{
+	return (tv.tv_sec * 1000000LL + tv.tv_usec);
+}
+
+/**
+ * @brief Writes a number with at least `width` digits, padded with zeros.
+ * 
+ * @param buf The output buffer.
+ * @param n The non-negative number.
+ * @param width The minimum number of digits.
+ * 
+ * @return The number of characters written.
+ */
+static int	put_digits(char *buf, long long n, int width)
+{
+	char	tmp[24];
+	int		len;
+	int		i;
+
+	len = 0;
+	while (n > 0 || len < width)
+	{
+		tmp[len++] = '0' + n % 10;
+		n /= 10;
+	}
+	i = 0;
+	while (i < len)
+	{
+		buf[i] = tmp[len - 1 - i];
+		i++;
+	}
+	return (len);
+}
+
+/**
+ * @brief Prints one line of the `time` report to standard error.
+ * 
+ * The default format is bash's (`real\t0m0.004s`); `time -p` uses the 
+ * POSIX one (`real 0.00`).
+ * 
+ * @param label The name of the line: `real`, `user` or `sys`.
+ * @param usec The time in microseconds.
+ * @param format `TIMED` or `TIMED_POSIX`.
+ */
+static void	put_time(char *label, long long usec, int format)
+{
+	char	buf[64];
+	int		len;
+
+	len = ft_strlen(label);
+	ft_memcpy(buf, label, len);
+	if (format == TIMED_POSIX)
+	{
+		buf[len++] = ' ';
+		len += put_digits(buf + len, usec / 1000000, 1);
+		buf[len++] = '.';
+		len += put_digits(buf + len, usec / 10000 % 100, 2);
+	}
+	else
+	{
+		buf[len++] = '\t';
+		len += put_digits(buf + len, usec / 60000000, 1);
+		buf[len++] = 'm';
+		len += put_digits(buf + len, usec / 1000000 % 60, 1);
+		buf[len++] = '.';
+		len += put_digits(buf + len, usec / 1000 % 1000, 3);
+		buf[len++] = 's';
+	}
+	buf[len++] = '\n';
+	write(STDERR_FILENO, buf, len);
+}
+
+/**
+ * @brief Starts timing a pipeline preceded by `time`.
+ * 
+ * The wall clock is read from the monotonic clock and the shell's own CPU 
+ * time with `getrusage`. The CPU time of the children is added as 
+ * `finish_children` reaps them with `wait4`.
+ * 
+ * @param ms A pointer to the main shell structure.
+ */
+void	timer_start(t_ms *ms)
+{
+	ms->timer.user = 0;
+	ms->timer.sys = 0;
+	getrusage(RUSAGE_SELF, &ms->timer.self);
+	ms->timer.start = trace_now();
+}
+
+/**
+ * @brief Prints the real, user and system time of a timed pipeline.
+ * 
+ * User and system time are those of the reaped children plus what the 
+ * shell itself spent meanwhile, on expansion, heredocs and builtins run 
+ * without forking.
+ * 
+ * @param ms A pointer to the main shell structure.
+ * @param format `TIMED` or `TIMED_POSIX`.
+ */
+void	timer_report(t_ms *ms, int format)
+{
+	struct rusage	now;
+	long long		real;
+
+	real = (trace_now() - ms->timer.start) / 1000;
+	getrusage(RUSAGE_SELF, &now);
+	if (format != TIMED_POSIX)
+		write(STDERR_FILENO, "\n", 1);
+	put_time("real", real, format);
+	put_time("user", ms->timer.user + tv_usec(now.ru_utime)
+		- tv_usec(ms->timer.self.ru_utime), format);
+	put_time("sys", ms->timer.sys + tv_usec(now.ru_stime)
+		- tv_usec(ms->timer.self.ru_stime), format);
+}
@@ -0,0 +1,67 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   job_status.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: agent <agent@local>                        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 02:17:15 by agent             #+#    #+#             */
+/*   Updated: 2026/10/17 03:13:23 by agent            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../include/minishell.h"
+
+/**
+ * @brief Prints the state of a job the way `jobs` shows it.
+ * 
+ * A job is "Running" while any of its processes is, "Done" when its last 
+ * stage exited with 0 and "Exit N" otherwise.
+ * 
+ * @param job The job to print.
+ * @param running The number of processes of the job still running.
+ */
+void	job_print(t_job *job, int running)
+{
+	int	status;
+
+	status = job->kids[job->n - 1].status;
+	if (running)
+		ft_printf(STDOUT_FILENO, "[%d]  Running\t%s\n", job->id, job->line);
+	else if (status == 0)
+		ft_printf(STDOUT_FILENO, "[%d]  Done\t%s\n", job->id, job->line);
+	else
+		ft_printf(STDOUT_FILENO, "[%d]  Exit %d\t%s\n", job->id, status,
+			job->line);
+}
+
+/**
+ * @brief Reaps finished background processes before the next prompt.
+ * 
+ * Every job is checked without blocking, so finished processes do not linger 
+ * as zombies. An interactive shell then reports the jobs that are done and 
+ * forgets them. In a `-c` string or a script, even one started from a 
+ * terminal, they stay in the table until `wait` or `jobs` collects their 
+ * status, like bash keeps them for `wait`.
+ * 
+ * @param ms A pointer to the main shell structure.
+ */
+void	jobs_notify(t_ms *ms)
+{
+	t_job	*job;
+	t_job	*next;
+	int		tty;
+
+	job = ms->jobs.first;
+	tty = (!ms->script_mode && isatty(STDIN_FILENO));
+	while (job)
+	{
+		next = job->next;
+		if (children_poll(job->kids, job->n) == 0 && tty)
+		{
+			job_print(job, 0);
+			job_remove(ms, job);
+		}
+		job = next;
+	}
+}
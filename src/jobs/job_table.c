@@ -0,0 +1,116 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   job_table.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: agent <agent@local>                        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 02:17:15 by agent             #+#    #+#             */
+/*   Updated: 2026/10/17 02:17:15 by agent            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../include/minishell.h"
+
+/**
+ * @brief Fills in a new job from the command line being started.
+ * 
+ * @param job The job to fill in, already linked into the table.
+ * @param ms A pointer to the main shell structure.
+ * @param kids The child table of the job.
+ * @param n The number of stages.
+ */
+void	job_init(t_job *job, t_ms *ms, t_child *kids, int n)
+{
+	job->pgid = ms->jobs.pgid;
+	job->line = ms->jobs.line;
+	ms->jobs.line = NULL;
+	job->kids = kids;
+	job->n = n;
+	job->next = NULL;
+	ms->jobs.last_pid = kids[n - 1].pid;
+	ms->exit_status = 0;
+}
+
+/**
+ * @brief Frees a job and closes the pidfds it still holds.
+ * 
+ * The processes of the job are not touched; a job that is still running 
+ * simply continues without the shell.
+ * 
+ * @param job The job to free.
+ */
+static void	job_free(t_job *job)
+{
+	children_release(job->kids, job->n);
+	free(job->kids);
+	free(job->line);
+	free(job);
+}
+
+/**
+ * @brief Unlinks a job from the job table and frees it.
+ * 
+ * @param ms A pointer to the main shell structure.
+ * @param job The job to remove.
+ */
+void	job_remove(t_ms *ms, t_job *job)
+{
+	t_job	**link;
+
+	link = &ms->jobs.first;
+	while (*link && *link != job)
+		link = &(*link)->next;
+	if (*link)
+		*link = job->next;
+	job_free(job);
+}
+
+/**
+ * @brief Frees the whole job table.
+ * 
+ * @param ms A pointer to the main shell structure.
+ */
+void	jobs_clear(t_ms *ms)
+{
+	t_job	*next;
+
+	while (ms->jobs.first)
+	{
+		next = ms->jobs.first->next;
+		job_free(ms->jobs.first);
+		ms->jobs.first = next;
+	}
+	free(ms->jobs.line);
+	ms->jobs.line = NULL;
+}
+
+/**
+ * @brief Finds a job by job number or by the pid of one of its processes.
+ * 
+ * @param ms A pointer to the main shell structure.
+ * @param pid A pid to look for, or 0.
+ * @param id A job number to look for, or 0.
+ * 
+ * @return The job, or NULL if no job matches.
+ */
+t_job	*job_find(t_ms *ms, pid_t pid, int id)
+{
+	t_job	*job;
+	int		i;
+
+	job = ms->jobs.first;
+	while (job)
+	{
+		if (id > 0 && job->id == id)
+			return (job);
+		i = 0;
+		while (pid > 0 && i < job->n)
+		{
+			if (job->kids[i++].pid == pid)
+				return (job);
+		}
+		job = job->next;
+	}
+	return (NULL);
+}
@@ -0,0 +1,111 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   jobs.c                                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: agent <agent@local>                        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 02:17:15 by agent             #+#    #+#             */
+/*   Updated: 2026/10/17 03:13:23 by agent            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../include/minishell.h"
+
+/**
+ * @brief Moves a background process into the job's process group.
+ * 
+ * The first process of a job leads a new process group and the other 
+ * stages join it, so a Ctrl-C at the terminal only reaches foreground 
+ * commands. It is called on both sides of a fork, with `pid` 0 in the 
+ * child, which avoids a race between the two. Foreground commands are 
+ * left alone.
+ * 
+ * @param ms A pointer to the main shell structure.
+ * @param pid The pid of the new process, or 0 in the process itself.
+ */
+void	job_setpgid(t_ms *ms, pid_t pid)
+{
+	if (!ms->jobs.background)
+		return ;
+	if (pid == 0)
+	{
+		setpgid(0, ms->jobs.pgid);
+		return ;
+	}
+	if (ms->jobs.pgid == 0)
+		ms->jobs.pgid = pid;
+	setpgid(pid, ms->jobs.pgid);
+}
+
+/**
+ * @brief Gives a background command line `/dev/null` as standard input.
+ * 
+ * Like bash without job control, a background job never reads from the 
+ * terminal, unless its first command redirects its input itself.
+ * 
+ * @param cmds The first command of the line.
+ */
+void	job_detach_stdin(t_cmd *cmds)
+{
+	if (cmds && cmds->infile == DEF)
+		cmds->infile = open(DEV_NULL, O_RDONLY | O_CLOEXEC);
+	if (cmds && cmds->infile < 0)
+		cmds->infile = DEF;
+}
+
+/**
+ * @brief Adds a started pipeline to the job table.
+ * 
+ * The job takes over the child table and the command text. Jobs are 
+ * numbered after the highest number in use, `$!` becomes the pid of the 
+ * last stage and the exit status is 0, as in bash. An interactive shell 
+ * prints the job number and process group; a `-c` string or a script run 
+ * from a terminal does not.
+ * 
+ * @param ms A pointer to the main shell structure.
+ * @param kids The child table of the job; it now belongs to the job.
+ * @param n The number of stages.
+ */
+void	job_add(t_ms *ms, t_child *kids, int n)
+{
+	t_job	*job;
+	t_job	**tail;
+
+	job = (t_job *)malloc(sizeof(t_job));
+	if (!job)
+	{
+		children_release(kids, n);
+		free(kids);
+		print_malloc_set_status(ms);
+		return ;
+	}
+	job->id = 1;
+	tail = &ms->jobs.first;
+	while (*tail)
+	{
+		job->id = (*tail)->id + 1;
+		tail = &(*tail)->next;
+	}
+	*tail = job;
+	job_init(job, ms, kids, n);
+	if (!ms->script_mode && isatty(STDIN_FILENO))
+		ft_printf(STDERR_FILENO, "[%d] %d\n", job->id, job->pgid);
+}
+
+/**
+ * @brief Adds a background simple command to the job table.
+ * 
+ * @param ms A pointer to the main shell structure.
+ * @param pid The pid of the command.
+ */
+void	job_add_pid(t_ms *ms, pid_t pid)
+{
+	t_child	*kids;
+
+	kids = children_new(1, ms);
+	if (!kids)
+		return ;
+	child_watch(kids, pid);
+	job_add(ms, kids, 1);
+}
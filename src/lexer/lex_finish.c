@@ -0,0 +1,180 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   lex_finish.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: agent <agent@local>                        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 01:52:35 by agent             #+#    #+#             */
+/*   Updated: 2026/10/17 01:56:49 by agent            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../include/minishell.h"
+
+/**
+ * @brief Checks for ambiguous redirections.
+ * 
+ * Only a word's first segment is checked, as before the segments were 
+ * merged. If it is unquoted and expands to an empty string or to multiple 
+ * words, the word is flagged as ambiguous and the segment's original text 
+ * is kept as the file name for the error message.
+ * 
+ * @param tok A pointer to the word being finished.
+ * @param seg The word's first segment.
+ * @param original The segment's text before expansion.
+ * @param sb The builder holding the word so far, i.e. the expanded segment.
+ */
+static void	check_ambiguity(t_token *tok, t_seg *seg, char *original,
+	t_strbuf *sb)
+{
+	if (tok->specific_redir && !seg->quote && original[0]
+		&& (!sb->buf[0] || has_multiple_words(sb->buf)))
+	{
+		tok->ambiguous = true;
+		tok->file = original;
+	}
+}
+
+/**
+ * @brief Appends one segment of a word to the builder, expanding it if 
+ * needed.
+ * 
+ * Single-quoted segments, heredoc delimiters and segments without a `$` are 
+ * copied straight from the input line. A lone unquoted `$` followed by a 
+ * quoted segment expands to nothing. Everything else goes through the 
+ * variable expansion.
+ * 
+ * @param tok A pointer to the word being finished.
+ * @param seg The segment to append.
+ * @param sb The builder collecting the word.
+ * @param ms A pointer to the main shell structure.
+ * 
+ * @return `1` on success, `0` if an allocation fails.
+ */
+static int	expand_segment(t_token *tok, t_seg *seg, t_strbuf *sb, t_ms *ms)
+{
+	t_expand	exp;
+	char		*original;
+
+	if (seg->quote == SG_QUOT || tok->specific_redir == HEREDOC
+		|| !seg->dollar)
+		return (sb_append(sb, seg->start, seg->len, ms));
+	original = arena_strndup(ms, seg->start, seg->len);
+	if (!original)
+		return (0);
+	if (!(seg->len == 1 && !seg->quote && seg->next && seg->next->quote))
+	{
+		ft_memset(&exp, 0, sizeof(t_expand));
+		exp.data = original;
+		exp.quote = seg->quote;
+		exp.if_first = (seg == tok->segs);
+		if (!expand_to_builder(&exp, ms, sb))
+			return (0);
+		if (seg == tok->segs)
+			tok->expanded = exp.expanded;
+	}
+	if (seg == tok->segs)
+		check_ambiguity(tok, seg, original, sb);
+	return (1);
+}
+
+/**
+ * @brief Builds the final text of a WORD token from its segments.
+ * 
+ * The segments are expanded into one reused builder and the result is copied 
+ * into the line arena.
+ * 
+ * @param tok A pointer to the word to finish.
+ * @param sb The builder, emptied for each word.
+ * @param ms A pointer to the main shell structure.
+ * 
+ * @return `1` on success, `0` if an allocation fails.
+ */
+static int	finish_word(t_token *tok, t_strbuf *sb, t_ms *ms)
+{
+	t_seg	*seg;
+
+	sb->len = 0;
+	sb->buf[0] = '\0';
+	seg = tok->segs;
+	while (seg)
+	{
+		if (!expand_segment(tok, seg, sb, ms))
+			return (0);
+		seg = seg->next;
+	}
+	tok->data = arena_strndup(ms, sb->buf, sb->len);
+	if (!tok->data)
+		return (0);
+	return (1);
+}
+
+/**
+ * @brief Applies tilde expansion and attaches redirection files.
+ * 
+ * Runs once every word has been expanded, so a failed home lookup cannot 
+ * change the `$?` seen by later words. A word that follows a redirection 
+ * becomes that redirection's file, and unquoted words that expanded to 
+ * nothing are dropped. The kept tokens are moved down in place, so the 
+ * vector stays contiguous.
+ * 
+ * @param toks A pointer to the token vector.
+ * @param ms A pointer to the main shell structure.
+ * 
+ * @return `1` on success, `0` if an allocation fails.
+ */
+static int	compact_tokens(t_tokens *toks, t_ms *ms)
+{
+	t_token	*cur;
+	size_t	r;
+	size_t	w;
+
+	r = 0;
+	w = 0;
+	while (r < toks->len)
+	{
+		cur = &toks->arr[r++];
+		if (cur->type == WORD && !cur->quote && cur->data[0] == '~'
+			&& expand_tilde(cur, ms) == 1)
+			return (0);
+		if (cur->type == WORD && w > 0 && is_redirect(toks->arr[w - 1].type)
+			&& !toks->arr[w - 1].file)
+			process_redirection_file(&toks->arr[w - 1], cur);
+		else if (!is_empty_word_token(cur))
+			toks->arr[w++] = *cur;
+	}
+	toks->len = w;
+	return (1);
+}
+
+/**
+ * @brief Finishes the tokens produced by the lexer.
+ * 
+ * Every word is expanded and joined from its segments, then the vector is 
+ * compacted by `compact_tokens`.
+ * 
+ * @param toks A pointer to the token vector.
+ * @param ms A pointer to the main shell structure.
+ * 
+ * @return `1` on success, `0` if an allocation fails.
+ */
+int	finish_tokens(t_tokens *toks, t_ms *ms)
+{
+	t_strbuf	sb;
+	size_t		i;
+
+	if (!sb_init(&sb, STRBUF_SIZE, ms))
+		return (0);
+	i = 0;
+	while (i < toks->len)
+	{
+		if (toks->arr[i].type == WORD && !finish_word(&toks->arr[i], &sb, ms))
+			break ;
+		i++;
+	}
+	sb_free(&sb);
+	if (i < toks->len)
+		return (0);
+	return (compact_tokens(toks, ms));
+}
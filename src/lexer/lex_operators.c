@@ -0,0 +1,125 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   lex_operators.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: agent <agent@local>                        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 01:52:35 by agent             #+#    #+#             */
+/*   Updated: 2026/10/17 02:24:25 by agent            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../include/minishell.h"
+
+/**
+ * @brief Lexes a redirection operator (`<`, `>`, `<<` or `>>`).
+ * 
+ * A redirection must be followed by a word, so an operator arriving while 
+ * the previous one still waits for its file is a syntax error. The word 
+ * that follows is tagged with the redirection type when it starts.
+ * 
+ * @param lx A pointer to the lexer state.
+ * 
+ * @return `1` on success, `0` if an allocation fails.
+ */
+int	lex_redirect(t_lexer *lx)
+{
+	t_type	type;
+
+	if (lx->redir != EMPTY)
+		return (lex_error(lx));
+	type = define_token_type(lx->str, lx->i);
+	if (!create_new_token(lx, type))
+		return (0);
+	skip_special_tokens(lx->str, &lx->i, type);
+	lx->word = NULL;
+	lx->after_quote = false;
+	lx->redir = type;
+	lx->redir_chain = true;
+	lx->cmd_empty = false;
+	return (1);
+}
+
+/**
+ * @brief Lexes a pipe.
+ * 
+ * A pipe needs a command on both sides: it is rejected at the start of a 
+ * command, right after a redirection, and when only whitespace follows it. In 
+ * the last case the error points just past the pipe, like the old validator 
+ * reported it.
+ * 
+ * @param lx A pointer to the lexer state.
+ * 
+ * @return `1` on success, `0` if an allocation fails.
+ */
+int	lex_pipe(t_lexer *lx)
+{
+	if (lx->redir != EMPTY || lx->cmd_empty)
+		return (lex_error(lx));
+	if (!create_new_token(lx, PIPE))
+		return (0);
+	lx->i++;
+	lx->word = NULL;
+	lx->after_quote = false;
+	lx->redir_chain = false;
+	lx->cmd_empty = true;
+	if (ft_isemptystring(lx->str + lx->i))
+		return (lex_error(lx));
+	return (1);
+}
+
+/**
+ * @brief Tells which list operator starts at a position.
+ * 
+ * @param s The input at the operator.
+ * 
+ * @return `AND_IF` for `&&`, `OR_IF` for `||`, `BACKGROUND` for `&` and 
+ *         `SEMI` for `;`.
+ */
+static t_type	control_type(char *s)
+{
+	if (s[0] == AND && s[1] == AND)
+		return (AND_IF);
+	if (s[0] == VERTICAL)
+		return (OR_IF);
+	if (s[0] == AND)
+		return (BACKGROUND);
+	return (SEMI);
+}
+
+/**
+ * @brief Lexes a list operator: `;`, `&`, `&&` or `||`.
+ * 
+ * Every list operator ends a complete command, so it is rejected at the start 
+ * of a command and right after a redirection, and `;;` is refused as bash 
+ * does. `;` and `&` may end the line, but `&&` and `||` need a command after 
+ * them; when only whitespace follows, the error points just past the operator, 
+ * as for a pipe.
+ * 
+ * @param lx A pointer to the lexer state.
+ * 
+ * @return `1` on success, `0` if an allocation fails.
+ */
+int	lex_control(t_lexer *lx)
+{
+	t_type	type;
+
+	type = control_type(lx->str + lx->i);
+	if (lx->redir != EMPTY || lx->cmd_empty
+		|| (type == SEMI && lx->str[lx->i + 1] == SCOLON))
+		return (lex_error(lx));
+	if (!create_new_token(lx, type))
+		return (0);
+	lx->i++;
+	if (type == AND_IF || type == OR_IF)
+		lx->i++;
+	lx->word = NULL;
+	lx->after_quote = false;
+	lx->redir_chain = false;
+	lx->cmd_empty = true;
+	if ((type == AND_IF || type == OR_IF)
+		&& ft_isemptystring(lx->str + lx->i))
+		return (lex_error(lx));
+	return (1);
+}
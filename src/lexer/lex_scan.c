@@ -0,0 +1,97 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   lex_scan.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: agent <agent@local>                        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 02:01:05 by agent             #+#    #+#             */
+/*   Updated: 2026/10/17 02:24:25 by agent            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../include/minishell.h"
+
+/**
+ * @brief Tells whether a byte ends the current run of the lexer.
+ * 
+ * Inside quotes only the matching quote and the terminator stop the run. 
+ * Outside quotes, whitespace, quotes and the operator characters `|`, `&`, 
+ * `;`, `<` and `>` do as well.
+ * 
+ * @param c The byte to classify.
+ * @param quote The open quote character, or `0` outside quotes.
+ * 
+ * @return `1` if `c` stops the run, `0` otherwise.
+ */
+static int	is_stop(char c, char quote)
+{
+	if (c == NULL_TERM)
+		return (1);
+	if (quote)
+		return (c == quote);
+	return (ft_isspace(c) || c == SG_QUOT || c == DB_QUOT
+		|| c == VERTICAL || c == AND || c == SCOLON || c == L_REDIR
+		|| c == R_REDIR);
+}
+
+/**
+ * @brief Measures a run of ordinary bytes one byte at a time.
+ * 
+ * This is the portable scanner; `scan_sse2` and `scan_avx2` give the same 
+ * results 16 and 32 bytes at a time.
+ * 
+ * @param s The start of the run.
+ * @param quote The open quote character, or `0` outside quotes.
+ * @param dollar Set to `true` if a `$` occurs in the run, `false` otherwise.
+ * 
+ * @return The number of bytes before the first byte that stops the run.
+ */
+size_t	scan_scalar(const char *s, char quote, t_bool *dollar)
+{
+	size_t	len;
+
+	len = 0;
+	*dollar = false;
+	while (!is_stop(s[len], quote))
+	{
+		if (s[len] == DOLLAR)
+			*dollar = true;
+		len++;
+	}
+	return (len);
+}
+
+#ifdef __SSE2__
+
+/**
+ * @brief Picks the fastest scanner the CPU supports.
+ * 
+ * Every x86-64 CPU has SSE2; AVX2 is checked at runtime, so one binary 
+ * runs everywhere and uses the wider registers where they exist.
+ * 
+ * @return The scanner the lexer should use.
+ */
+t_scan	lex_scanner(void)
+{
+	__builtin_cpu_init();
+	if (__builtin_cpu_supports("avx2"))
+		return (&scan_avx2);
+	return (&scan_sse2);
+}
+
+#else
+
+/**
+ * @brief Picks the scanner the lexer should use.
+ * 
+ * Without SSE2 only the portable scanner is built.
+ * 
+ * @return The scanner the lexer should use.
+ */
+t_scan	lex_scanner(void)
+{
+	return (&scan_scalar);
+}
+
+#endif
@@ -0,0 +1,119 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   lex_scan_avx2.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: agent <agent@local>                        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 02:01:05 by agent             #+#    #+#             */
+/*   Updated: 2026/10/17 02:24:25 by agent            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../include/minishell.h"
+
+#ifdef __SSE2__
+
+# include <immintrin.h>
+
+/**
+ * @brief Marks the bytes of a 32-byte block that stop a lexer run.
+ * 
+ * The whitespace range `\t`..`\r` is tested with one unsigned compare: 
+ * after subtracting `\t` it is exactly the bytes not above 4.
+ * 
+ * @param v The block to classify.
+ * @param quote The open quote character, or `0` outside quotes.
+ * 
+ * @return A 32-bit mask with one bit per stopping byte.
+ */
+__attribute__((target("avx2")))
+static unsigned int	avx2_stops(__m256i v, char quote)
+{
+	__m256i	m;
+	__m256i	t;
+
+	m = _mm256_cmpeq_epi8(v, _mm256_setzero_si256());
+	if (quote)
+		return (_mm256_movemask_epi8(_mm256_or_si256(m,
+					_mm256_cmpeq_epi8(v, _mm256_set1_epi8(quote)))));
+	t = _mm256_sub_epi8(v, _mm256_set1_epi8(TAB));
+	t = _mm256_cmpeq_epi8(_mm256_min_epu8(t, _mm256_set1_epi8(4)), t);
+	m = _mm256_or_si256(m, t);
+	m = _mm256_or_si256(m, _mm256_cmpeq_epi8(v, _mm256_set1_epi8(WSPACE)));
+	m = _mm256_or_si256(m, _mm256_cmpeq_epi8(v, _mm256_set1_epi8(SG_QUOT)));
+	m = _mm256_or_si256(m, _mm256_cmpeq_epi8(v, _mm256_set1_epi8(DB_QUOT)));
+	m = _mm256_or_si256(m, _mm256_cmpeq_epi8(v, _mm256_set1_epi8(VERTICAL)));
+	m = _mm256_or_si256(m, _mm256_cmpeq_epi8(v, _mm256_set1_epi8(AND)));
+	m = _mm256_or_si256(m, _mm256_cmpeq_epi8(v, _mm256_set1_epi8(SCOLON)));
+	m = _mm256_or_si256(m, _mm256_cmpeq_epi8(v, _mm256_set1_epi8(L_REDIR)));
+	m = _mm256_or_si256(m, _mm256_cmpeq_epi8(v, _mm256_set1_epi8(R_REDIR)));
+	return (_mm256_movemask_epi8(m));
+}
+
+/**
+ * @brief Loads one aligned block and classifies its bytes.
+ * 
+ * The load may read past the terminator, but never past the aligned block 
+ * that holds it, so it cannot cross into an unmapped page. Those reads are 
+ * deliberate, so the address sanitizer is turned off here.
+ * 
+ * @param p The address of the block, aligned to 32 bytes.
+ * @param quote The open quote character, or `0` outside quotes.
+ * @param dol Set to the mask of `$` bytes in the block.
+ * 
+ * @return The mask of bytes that stop a lexer run.
+ */
+__attribute__((target("avx2"), no_sanitize_address))
+static unsigned int	avx2_block(const char *p, char quote, unsigned int *dol)
+{
+	__m256i	v;
+
+	v = _mm256_load_si256((const __m256i *)p);
+	*dol = _mm256_movemask_epi8(_mm256_cmpeq_epi8(v, _mm256_set1_epi8(DOLLAR)));
+	return (avx2_stops(v, quote));
+}
+
+/**
+ * @brief Measures a run of ordinary bytes 32 bytes at a time.
+ * 
+ * Compiled for AVX2 whatever the build flags are, and only called once 
+ * `lex_scanner` has checked that the CPU supports it.
+ * 
+ * Only aligned blocks are loaded; the bits of the first block that lie 
+ * before `s` are shifted out.
+ * 
+ * @param s The start of the run.
+ * @param quote The open quote character, or `0` outside quotes.
+ * @param dollar Set to `true` if a `$` occurs in the run, `false` otherwise.
+ * 
+ * @return The number of bytes before the first byte that stops the run.
+ */
+__attribute__((target("avx2")))
+size_t	scan_avx2(const char *s, char quote, t_bool *dollar)
+{
+	const char		*base;
+	unsigned int	stop;
+	unsigned int	dol;
+	size_t			shift;
+
+	*dollar = false;
+	shift = (uintptr_t)s & 31;
+	base = s - shift;
+	stop = avx2_block(base, quote, &dol) >> shift;
+	dol >>= shift;
+	while (!stop)
+	{
+		if (dol)
+			*dollar = true;
+		base += 32;
+		shift = 0;
+		stop = avx2_block(base, quote, &dol);
+	}
+	stop = __builtin_ctz(stop);
+	if (dol & ((1u << stop) - 1))
+		*dollar = true;
+	return (base + shift + stop - s);
+}
+
+#endif
@@ -0,0 +1,114 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   lex_scan_sse2.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: agent <agent@local>                        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 02:01:05 by agent             #+#    #+#             */
+/*   Updated: 2026/10/17 02:24:25 by agent            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../include/minishell.h"
+
+#ifdef __SSE2__
+
+# include <emmintrin.h>
+
+/**
+ * @brief Marks the bytes of a 16-byte block that stop a lexer run.
+ * 
+ * The whitespace range `\t`..`\r` is tested with one unsigned compare: 
+ * after subtracting `\t` it is exactly the bytes not above 4.
+ * 
+ * @param v The block to classify.
+ * @param quote The open quote character, or `0` outside quotes.
+ * 
+ * @return A 16-bit mask with one bit per stopping byte.
+ */
+static unsigned int	sse2_stops(__m128i v, char quote)
+{
+	__m128i	m;
+	__m128i	t;
+
+	m = _mm_cmpeq_epi8(v, _mm_setzero_si128());
+	if (quote)
+		return (_mm_movemask_epi8(_mm_or_si128(m,
+					_mm_cmpeq_epi8(v, _mm_set1_epi8(quote)))));
+	t = _mm_sub_epi8(v, _mm_set1_epi8(TAB));
+	t = _mm_cmpeq_epi8(_mm_min_epu8(t, _mm_set1_epi8(4)), t);
+	m = _mm_or_si128(m, t);
+	m = _mm_or_si128(m, _mm_cmpeq_epi8(v, _mm_set1_epi8(WSPACE)));
+	m = _mm_or_si128(m, _mm_cmpeq_epi8(v, _mm_set1_epi8(SG_QUOT)));
+	m = _mm_or_si128(m, _mm_cmpeq_epi8(v, _mm_set1_epi8(DB_QUOT)));
+	m = _mm_or_si128(m, _mm_cmpeq_epi8(v, _mm_set1_epi8(VERTICAL)));
+	m = _mm_or_si128(m, _mm_cmpeq_epi8(v, _mm_set1_epi8(AND)));
+	m = _mm_or_si128(m, _mm_cmpeq_epi8(v, _mm_set1_epi8(SCOLON)));
+	m = _mm_or_si128(m, _mm_cmpeq_epi8(v, _mm_set1_epi8(L_REDIR)));
+	m = _mm_or_si128(m, _mm_cmpeq_epi8(v, _mm_set1_epi8(R_REDIR)));
+	return (_mm_movemask_epi8(m));
+}
+
+/**
+ * @brief Loads one aligned block and classifies its bytes.
+ * 
+ * The load may read past the terminator, but never past the aligned block 
+ * that holds it, so it cannot cross into an unmapped page. Those reads are 
+ * deliberate, so the address sanitizer is turned off here.
+ * 
+ * @param p The address of the block, aligned to 16 bytes.
+ * @param quote The open quote character, or `0` outside quotes.
+ * @param dol Set to the mask of `$` bytes in the block.
+ * 
+ * @return The mask of bytes that stop a lexer run.
+ */
+__attribute__((no_sanitize_address))
+static unsigned int	sse2_block(const char *p, char quote, unsigned int *dol)
+{
+	__m128i	v;
+
+	v = _mm_load_si128((const __m128i *)p);
+	*dol = _mm_movemask_epi8(_mm_cmpeq_epi8(v, _mm_set1_epi8(DOLLAR)));
+	return (sse2_stops(v, quote));
+}
+
+/**
+ * @brief Measures a run of ordinary bytes 16 bytes at a time.
+ * 
+ * Only aligned blocks are loaded; the bits of the first block that lie 
+ * before `s` are shifted out.
+ * 
+ * @param s The start of the run.
+ * @param quote The open quote character, or `0` outside quotes.
+ * @param dollar Set to `true` if a `$` occurs in the run, `false` otherwise.
+ * 
+ * @return The number of bytes before the first byte that stops the run.
+ */
+size_t	scan_sse2(const char *s, char quote, t_bool *dollar)
+{
+	const char		*base;
+	unsigned int	stop;
+	unsigned int	dol;
+	size_t			shift;
+
+	*dollar = false;
+	shift = (uintptr_t)s & 15;
+	base = s - shift;
+	stop = sse2_block(base, quote, &dol) >> shift;
+	dol >>= shift;
+	while (!stop)
+	{
+		if (dol)
+			*dollar = true;
+		base += 16;
+		shift = 0;
+		stop = sse2_block(base, quote, &dol);
+	}
+	stop = __builtin_ctz(stop);
+	if (dol & ((1u << stop) - 1))
+		*dollar = true;
+	return (base + shift + stop - s);
+}
+
+#endif
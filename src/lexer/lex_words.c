@@ -0,0 +1,133 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   lex_words.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: agent <agent@local>                        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 01:52:35 by agent             #+#    #+#             */
+/*   Updated: 2026/10/17 02:01:05 by agent            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../include/minishell.h"
+
+/**
+ * @brief Starts a new WORD token.
+ * 
+ * If a redirection is waiting for its file, the word is tagged with the 
+ * redirection type, which decides later how it is expanded.
+ * 
+ * @param lx A pointer to the lexer state.
+ * 
+ * @return `1` on success, `0` if an allocation fails.
+ */
+static int	start_word(t_lexer *lx)
+{
+	lx->word = create_new_token(lx, WORD);
+	if (!lx->word)
+		return (0);
+	lx->word->specific_redir = lx->redir;
+	if (lx->redir == EMPTY)
+		lx->redir_chain = false;
+	lx->redir = EMPTY;
+	lx->seg = NULL;
+	lx->cmd_empty = false;
+	return (1);
+}
+
+/**
+ * @brief Appends a quoted or unquoted part to the current word.
+ * 
+ * The segment points into the input line; nothing is copied. It is marked 
+ * as an expansion site if the scanner saw a `$` in it. The word's quote is 
+ * the quote of its first quoted segment.
+ * 
+ * @param lx A pointer to the lexer state.
+ * @param len The length of the segment, which starts at `lx->i`.
+ * @param quote The quote character around the segment, or 0.
+ * @param dollar Whether the segment contains a `$`.
+ * 
+ * @return `1` on success, `0` if an allocation fails.
+ */
+static int	add_segment(t_lexer *lx, size_t len, t_char quote, t_bool dollar)
+{
+	t_seg	*seg;
+
+	seg = (t_seg *)arena_alloc(lx->ms, sizeof(t_seg));
+	if (!seg)
+		return (0);
+	seg->start = lx->str + lx->i;
+	seg->len = len;
+	seg->quote = quote;
+	seg->dollar = dollar;
+	seg->next = NULL;
+	if (lx->seg && (!quote || lx->seg->quote))
+		lx->redir_chain = false;
+	if (lx->seg)
+		lx->seg->next = seg;
+	else
+		lx->word->segs = seg;
+	lx->seg = seg;
+	if (!lx->word->quote)
+		lx->word->quote = quote;
+	return (1);
+}
+
+/**
+ * @brief Lexes a quoted part of a word.
+ * 
+ * The part runs to the matching quote; a missing one is a syntax error 
+ * reported at the end of the line.
+ * 
+ * @param lx A pointer to the lexer state, positioned on the opening quote.
+ * 
+ * @return `1` on success, `0` if an allocation fails.
+ */
+static int	lex_quoted(t_lexer *lx)
+{
+	char	quote;
+	size_t	len;
+	t_bool	dollar;
+
+	quote = lx->str[lx->i++];
+	len = lx->ms->scan(lx->str + lx->i, quote, &dollar);
+	if (!lx->str[lx->i + len])
+	{
+		lx->i += len;
+		return (lex_error(lx));
+	}
+	if (!add_segment(lx, len, quote, dollar))
+		return (0);
+	lx->i += len + 1;
+	lx->after_quote = true;
+	return (1);
+}
+
+/**
+ * @brief Lexes one quoted or unquoted part of a word.
+ * 
+ * A new WORD token is started unless the previous part ended right here. An 
+ * unquoted part runs to the next whitespace, quote or operator character; 
+ * both kinds of part are measured by the scanner in `ms->scan`.
+ * 
+ * @param lx A pointer to the lexer state.
+ * 
+ * @return `1` on success, `0` if an allocation fails.
+ */
+int	lex_word(t_lexer *lx)
+{
+	size_t	len;
+	t_bool	dollar;
+
+	if (!lx->word && !start_word(lx))
+		return (0);
+	if (lx->str[lx->i] == SG_QUOT || lx->str[lx->i] == DB_QUOT)
+		return (lex_quoted(lx));
+	len = lx->ms->scan(lx->str + lx->i, 0, &dollar);
+	if (!add_segment(lx, len, 0, dollar))
+		return (0);
+	lx->i += len;
+	lx->after_quote = false;
+	return (1);
+}
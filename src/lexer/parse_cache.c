@@ -0,0 +1,134 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   parse_cache.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: agent <agent@local>                        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 02:04:19 by agent             #+#    #+#             */
+/*   Updated: 2026/10/17 02:24:25 by agent            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../include/minishell.h"
+
+/**
+ * @brief Makes an entry the most recently used one.
+ * 
+ * @param pc A pointer to the parse cache.
+ * @param entry The entry to put at the head of the recency list; it must 
+ *              not be in the list already.
+ */
+void	pcache_link(t_pcache *pc, t_parsed *entry)
+{
+	entry->older = pc->newest;
+	entry->newer = NULL;
+	if (pc->newest)
+		pc->newest->newer = entry;
+	pc->newest = entry;
+	if (!pc->oldest)
+		pc->oldest = entry;
+}
+
+/**
+ * @brief Takes an entry out of the recency list.
+ * 
+ * The entry stays in its hash chain; callers either link it again or 
+ * remove it from the chain too.
+ * 
+ * @param pc A pointer to the parse cache.
+ * @param entry The entry to take out.
+ */
+void	pcache_unlink(t_pcache *pc, t_parsed *entry)
+{
+	if (entry->newer)
+		entry->newer->older = entry->older;
+	else
+		pc->newest = entry->older;
+	if (entry->older)
+		entry->older->newer = entry->newer;
+	else
+		pc->oldest = entry->newer;
+	entry->newer = NULL;
+	entry->older = NULL;
+}
+
+/**
+ * @brief Finds the cached parse of a line.
+ * 
+ * @param pc A pointer to the parse cache.
+ * @param line The raw input line.
+ * @param hash The line's hash.
+ * 
+ * @return The entry, or NULL if the line is not cached.
+ */
+static t_parsed	*pcache_find(t_pcache *pc, char *line, size_t hash)
+{
+	t_parsed	*entry;
+
+	entry = pc->buckets[hash % PCACHE_BUCKETS];
+	while (entry)
+	{
+		if (entry->hash == hash && ft_strcmp(entry->line, line) == 0)
+			return (entry);
+		entry = entry->hnext;
+	}
+	return (NULL);
+}
+
+/**
+ * @brief Loads the tokens of a previously lexed line from the cache.
+ * 
+ * Loop-like scripts send the same text over and over. On a hit the cached 
+ * tokens, with their quote flags and segments, are copied into 
+ * `ms->tokens` and the lexer is skipped; expansion, tilde expansion and 
+ * redirections are still done by `finish_tokens` for every run. The entry 
+ * becomes the most recently used one.
+ * 
+ * @param ms A pointer to the main shell structure.
+ * @param line The raw input line.
+ * 
+ * @return `1` on a hit, `0` on a miss (including a failed allocation, 
+ *         which the lexer then runs into and reports).
+ */
+int	pcache_lookup(t_ms *ms, char *line)
+{
+	t_parsed	*entry;
+
+	entry = pcache_find(&ms->pcache, line, history_hash(line));
+	if (!entry || !tokens_reserve(&ms->tokens, entry->ntoks))
+	{
+		ms->pcache.misses++;
+		return (0);
+	}
+	ms->pcache.hits++;
+	pcache_unlink(&ms->pcache, entry);
+	pcache_link(&ms->pcache, entry);
+	ft_memcpy(ms->tokens.arr, entry->toks, entry->ntoks * sizeof(t_token));
+	ms->tokens.len = entry->ntoks;
+	return (1);
+}
+
+/**
+ * @brief Drops every cached line.
+ * 
+ * Each entry is a single allocation, so this frees one block per line. The 
+ * hit and miss counters are left alone.
+ * 
+ * @param pc A pointer to the parse cache.
+ */
+void	pcache_clear(t_pcache *pc)
+{
+	t_parsed	*entry;
+
+	while (pc->newest)
+	{
+		entry = pc->newest;
+		pc->newest = entry->older;
+		free(entry);
+	}
+	ft_memset(pc->buckets, 0, sizeof(pc->buckets));
+	pc->oldest = NULL;
+	pc->count = 0;
+	pc->drop = false;
+}
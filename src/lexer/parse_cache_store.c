@@ -0,0 +1,158 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   parse_cache_store.c                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: agent <agent@local>                        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 02:04:19 by agent             #+#    #+#             */
+/*   Updated: 2026/10/17 02:04:19 by agent            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../include/minishell.h"
+
+/**
+ * @brief Counts the segments of all tokens in the vector.
+ * 
+ * @param toks A pointer to the token vector.
+ * 
+ * @return The total number of segments.
+ */
+static size_t	count_segs(t_tokens *toks)
+{
+	size_t	count;
+	size_t	i;
+	t_seg	*seg;
+
+	count = 0;
+	i = 0;
+	while (i < toks->len)
+	{
+		seg = toks->arr[i++].segs;
+		while (seg)
+		{
+			count++;
+			seg = seg->next;
+		}
+	}
+	return (count);
+}
+
+/**
+ * @brief Copies the freshly lexed tokens and their segments into an entry.
+ * 
+ * The segments are rebased from the input line, which is about to be 
+ * freed, onto the entry's own copy of it, and relinked inside the entry.
+ * 
+ * @param entry The entry being filled; `line` and `toks` are already set.
+ * @param toks A pointer to the token vector, straight from the lexer.
+ * @param line The input line the segments point into.
+ * @param segs The entry's segment storage.
+ */
+static void	copy_templates(t_parsed *entry, t_tokens *toks, char *line,
+		t_seg *segs)
+{
+	size_t	i;
+	t_seg	*seg;
+	t_seg	**link;
+
+	i = 0;
+	while (i < toks->len)
+	{
+		entry->toks[i] = toks->arr[i];
+		link = &entry->toks[i].segs;
+		seg = toks->arr[i++].segs;
+		while (seg)
+		{
+			*segs = *seg;
+			segs->start = entry->line + (seg->start - line);
+			*link = segs;
+			link = &(segs++)->next;
+			seg = seg->next;
+		}
+		*link = NULL;
+	}
+}
+
+/**
+ * @brief Builds a cache entry for a freshly lexed line.
+ * 
+ * The entry, its tokens, its segments and its copy of the line share one 
+ * allocation, so dropping the entry is a single `free`.
+ * 
+ * @param toks A pointer to the token vector, straight from the lexer.
+ * @param line The input line.
+ * @param len The length of the line.
+ * 
+ * @return The new entry, or NULL if the allocation fails.
+ */
+static t_parsed	*new_entry(t_tokens *toks, char *line, size_t len)
+{
+	t_parsed	*entry;
+	size_t		size;
+
+	size = sizeof(t_parsed) + toks->len * sizeof(t_token)
+		+ count_segs(toks) * sizeof(t_seg);
+	entry = (t_parsed *)malloc(size + len + 1);
+	if (!entry)
+		return (NULL);
+	entry->toks = (t_token *)(entry + 1);
+	entry->ntoks = toks->len;
+	entry->line = (char *)entry + size;
+	ft_memcpy(entry->line, line, len + 1);
+	entry->hash = history_hash(line);
+	copy_templates(entry, toks, line, (t_seg *)(entry->toks + toks->len));
+	return (entry);
+}
+
+/**
+ * @brief Drops the least recently used entry.
+ * 
+ * @param pc A pointer to the parse cache, which must not be empty.
+ */
+static void	evict_oldest(t_pcache *pc)
+{
+	t_parsed	*old;
+	t_parsed	**link;
+
+	old = pc->oldest;
+	link = &pc->buckets[old->hash % PCACHE_BUCKETS];
+	while (*link != old)
+		link = &(*link)->hnext;
+	*link = old->hnext;
+	pcache_unlink(pc, old);
+	free(old);
+	pc->count--;
+}
+
+/**
+ * @brief Remembers the tokens of a line that just passed the lexer.
+ * 
+ * Must be called before `finish_tokens`, while the tokens still hold only 
+ * what the lexer produced. Lines longer than `PCACHE_LINE_MAX` are not 
+ * cached, and when the cache holds `PCACHE_SIZE` lines the least recently 
+ * used one makes room. A failed allocation only means the line is not 
+ * cached.
+ * 
+ * @param ms A pointer to the main shell structure.
+ * @param line The input line.
+ */
+void	pcache_store(t_ms *ms, char *line)
+{
+	t_parsed	*entry;
+	size_t		len;
+
+	len = ft_strlen(line);
+	if (len > PCACHE_LINE_MAX)
+		return ;
+	entry = new_entry(&ms->tokens, line, len);
+	if (!entry)
+		return ;
+	if (ms->pcache.count >= PCACHE_SIZE)
+		evict_oldest(&ms->pcache);
+	entry->hnext = ms->pcache.buckets[entry->hash % PCACHE_BUCKETS];
+	ms->pcache.buckets[entry->hash % PCACHE_BUCKETS] = entry;
+	pcache_link(&ms->pcache, entry);
+	ms->pcache.count++;
+}
@@ -6,7 +6,7 @@
 /*   By: ssalorin <ssalorin@student.hive.fi>        +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/03/27 13:59:05 by ssalorin          #+#    #+#             */
-/*   Updated: 2025/03/27 13:59:07 by ssalorin         ###   ########.fr       */
+/*   Updated: 2026/10/17 01:52:35 by agent            ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -34,22 +34,3 @@ void	skip_special_tokens(char *str, size_t *i, t_type type)
 	else if (str[*i] && (type != WORD && type != SPACE))
 		(*i)++;
 }
-
-/**
- * @brief Skips whitespace characters in a string.
- * 
- * This function advances the given index (`i`) in the string (`str`) 
- * past any leading whitespace characters. It ensures that parsing starts 
- * at the first non-whitespace character.
- * 
- * @param str A pointer to the input string.
- * @param i A pointer to the current index in the string, which is updated 
- *          to the next non-whitespace character.
- */
-void	skip_whitespaces(char *str, size_t *i)
-{
-	if (!str || !i)
-		return ;
-	while (str[*i] && ft_isspace(str[*i]))
-		(*i)++;
-}
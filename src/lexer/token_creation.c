@@ -6,7 +6,7 @@
 /*   By: ssalorin <ssalorin@student.hive.fi>        +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/03/27 13:59:24 by ssalorin          #+#    #+#             */
-/*   Updated: 2025/03/27 13:59:27 by ssalorin         ###   ########.fr       */
+/*   Updated: 2026/10/17 03:12:43 by agent            ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -56,74 +56,73 @@ static void	default_token_values(t_token *new)
 {
 	new->data = NULL;
 	new->file = NULL;
-	new->next = NULL;
 	new->quote = 0;
-	new->unclosed = false;
+	new->segs = NULL;
+	new->body = NULL;
 	new->specific_redir = EMPTY;
 	new->ambiguous = false;
 	new->expanded = false;
 }
 
 /**
- * @brief Processes a word token, handling quoted and unquoted words.
+ * @brief Makes room for `n` more tokens in the token vector.
  * 
- * This function determines whether the token starts with a single (`'`) or 
- * double (`"`) quote and processes it accordingly. If the word is quoted, 
- * it extracts the content while preserving the quote type. Otherwise, it 
- * extracts a regular word without quotes.
+ * The vector doubles its capacity, starting at `TOKENS_MIN`. It is kept 
+ * between lines, so after the first few commands no line needs to grow it.
  * 
- * @param str The input string containing the token to process.
- * @param i A pointer to the current index in the string, which will be 
- *          updated as characters are processed.
- * @param new A pointer to the newly created token structure where the 
- *            processed word data will be stored.
+ * @param toks A pointer to the token vector.
+ * @param n The number of tokens about to be added.
+ * 
+ * @return `1` on success, `0` if the allocation fails.
  */
-static void	process_word_token(char *str, size_t *i, t_token *new, t_ms *ms)
+int	tokens_reserve(t_tokens *toks, size_t n)
 {
-	if (str[*i] == SG_QUOT || str[*i] == DB_QUOT)
-	{
-		new->quote = str[*i];
-		new->data = word_with_quotes(str, i, new, ms);
-	}
-	else
-		new->data = word_without_quotes(str, i, ms);
+	t_token	*arr;
+	size_t	cap;
+
+	if (toks->len + n <= toks->cap)
+		return (1);
+	cap = toks->cap;
+	if (cap == 0)
+		cap = TOKENS_MIN;
+	while (cap < toks->len + n)
+		cap *= 2;
+	arr = (t_token *)malloc(cap * sizeof(t_token));
+	if (!arr)
+		return (0);
+	if (toks->arr)
+		ft_memcpy(arr, toks->arr, toks->len * sizeof(t_token));
+	free(toks->arr);
+	toks->arr = arr;
+	toks->cap = cap;
+	return (1);
 }
 
 /**
- * @brief Creates a new token from the input string.
+ * @brief Creates a new token at the end of the line's token vector.
  * 
- * This function allocates memory for a new token and initializes its values. 
- * It determines how to process the token based on its type: words are processed 
- * separately to handle quotes, spaces are skipped, and special tokens are 
- * handled accordingly. If memory allocation fails, the function sets an error 
- * status and returns NULL.
+ * This function initializes the next slot of `ms->tokens`, growing the vector 
+ * when it is full, and records the token's offset in the line. If memory 
+ * allocation fails, the malloc error status is set and NULL is returned. The 
+ * returned pointer is only valid until the next token is created.
  * 
- * @param str The input string from which the token is extracted.
- * @param i A pointer to the current index in the string, which will be updated 
- *          as characters are processed.
+ * @param lx A pointer to the lexer state.
  * @param type The type of token to be created.
- * @param ms A pointer to the main minishell structure, used for error handling.
  * 
  * @return A pointer to the newly created token, or NULL if an error occurs.
  */
-t_token	*create_new_token(char *str, size_t *i, t_type type, t_ms *ms)
+t_token	*create_new_token(t_lexer *lx, t_type type)
 {
 	t_token	*new;
 
-	new = (t_token *)ft_calloc(1, sizeof(t_token));
-	if (!new)
-		return ((t_token *)print_malloc_set_status(ms));
-	default_token_values(new);
-	new->type = type;
-	if (type == WORD)
+	if (!tokens_reserve(&lx->ms->tokens, 1))
 	{
-		process_word_token(str, i, new, ms);
-		if (!new->data)
-			return (NULL);
+		print_malloc_set_status(lx->ms);
+		return (NULL);
 	}
-	else if (type == SPACE)
-		skip_whitespaces(str, i);
-	else
-		skip_special_tokens(str, i, type);
+	new = &lx->ms->tokens.arr[lx->ms->tokens.len++];
+	default_token_values(new);
+	new->type = type;
+	new->pos = lx->i;
 	return (new);
 }
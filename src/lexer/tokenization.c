@@ -6,54 +6,150 @@
 /*   By: ssalorin <ssalorin@student.hive.fi>        +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/03/27 13:59:46 by ssalorin          #+#    #+#             */
-/*   Updated: 2025/03/27 13:59:53 by ssalorin         ###   ########.fr       */
+/*   Updated: 2026/10/17 02:24:25 by agent            ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
+
 #include "../../include/minishell.h"
 
 /**
- * @brief Tokenizes an input string into a linked list of tokens.
+ * @brief Records a syntax error at the current position.
+ * 
+ * The position is what `print_syntax_error` later reports as the unexpected 
+ * token.
+ * 
+ * @param lx A pointer to the lexer state.
+ * 
+ * @return Always `1`, so callers can return it as a successful step.
+ */
+int	lex_error(t_lexer *lx)
+{
+	lx->err = lx->str + lx->i;
+	return (1);
+}
+
+/**
+ * @brief Processes the character at the current position.
+ * 
+ * Whitespace ends the current word, `<`, `>`, `|` and the list operators `;`, 
+ * `&`, `&&` and `||` are operators, and everything else belongs to a word. A 
+ * `)` is rejected right after a closing quote, and after the whitespace that 
+ * ends a redirection's file name (`redir_chain`), as the grammar does.
  * 
- * This function processes a given command string, splitting it into tokens 
- * based on spaces, special characters (e.g. `<`, `>`, `|`), and quotes. 
- * It assigns each token a specific type and applies necessary post-processing 
- * such as handling redirections and merging adjacent words.
+ * @param lx A pointer to the lexer state.
+ * 
+ * @return `1` on success (including a recorded syntax error), `0` if an 
+ *         allocation fails.
+ */
+static int	lex_step(t_lexer *lx)
+{
+	char	c;
+
+	c = lx->str[lx->i];
+	if (ft_isspace(c))
+	{
+		lx->word = NULL;
+		lx->after_quote = false;
+		lx->i++;
+		return (1);
+	}
+	if (c == R_PARENT && (lx->after_quote
+			|| (lx->redir_chain && !lx->word && lx->redir == EMPTY)))
+		return (lex_error(lx));
+	if (c == SCOLON || c == AND
+		|| (c == VERTICAL && lx->str[lx->i + 1] == VERTICAL))
+		return (lex_control(lx));
+	if (c == L_REDIR || c == R_REDIR)
+		return (lex_redirect(lx));
+	if (c == VERTICAL)
+		return (lex_pipe(lx));
+	return (lex_word(lx));
+}
+
+/**
+ * @brief Prepares the lexer for a new input line.
+ * 
+ * @param lx A pointer to the lexer state.
+ * @param str The input line.
+ * @param ms A pointer to the main shell structure.
+ */
+static void	lexer_init(t_lexer *lx, char *str, t_ms *ms)
+{
+	lx->str = str;
+	lx->i = 0;
+	lx->word = NULL;
+	lx->seg = NULL;
+	lx->redir = EMPTY;
+	lx->cmd_empty = true;
+	lx->after_quote = false;
+	lx->redir_chain = false;
+	lx->err = NULL;
+	lx->ms = ms;
+}
+
+/**
+ * @brief Validates and tokenizes an input string in a single pass.
+ * 
+ * The input is scanned once, left to right, by a small state machine that 
+ * checks the syntax as it goes and emits redirection, pipe, list operator and 
+ * WORD tokens. Adjacent quoted and unquoted parts are collected into one WORD 
+ * token as segments, and segments containing a `$` are marked for expansion.
  * 
  * @param str The null-terminated input string to be tokenized.
- * @param ms A pointer to the t_ms structure, potentially used for expansions.
+ * @param ms A pointer to the t_ms structure, used for errors.
  * 
- * @return A pointer to the first token in the linked list, or NULL if 
- *       an error occurs.
+ * @return `1` on success, or `0` if an error occurs. On a syntax error the 
+ *       message is printed and `ms->err` is set to `SYNTAX_ERR`.
+ */
+static int	lex_line(char *str, t_ms *ms)
+{
+	t_lexer	lx;
+
+	lexer_init(&lx, str, ms);
+	while (str[lx.i] && !lx.err)
+	{
+		if (!lex_step(&lx))
+			return (0);
+	}
+	if (!lx.err && lx.redir != EMPTY)
+		lex_error(&lx);
+	if (lx.err)
+	{
+		print_syntax_error(lx.err);
+		ms->err = SYNTAX_ERR;
+		return (0);
+	}
+	return (1);
+}
+
+/**
+ * @brief Tokenizes an input string into the `ms->tokens` vector.
+ * 
+ * A line seen before takes its tokens from the parse cache; any other line 
+ * goes through `lex_line` and is then added to the cache. The tokens are 
+ * left raw: each pipeline of the line is expanded by `finish_tokens` right 
+ * before it runs, so variables, `$?` and the home directory are read 
+ * afresh, and an earlier command of the list can change them.
+ * 
+ * @param str The null-terminated input string to be tokenized.
+ * @param ms A pointer to the t_ms structure, used for the cache and errors.
  * 
- * @note The function allocates memory dynamically. The caller is responsible 
- *       for freeing the token list using clean_token_list().
+ * @return `1` on success, or `0` if an error occurs, in which case the 
+ *       vector is left empty. On a syntax error the message is printed and 
+ *       `ms->err` is set to `SYNTAX_ERR`.
  */
-t_token	*tokenization(char *str, t_ms *ms)
+int	tokenization(char *str, t_ms *ms)
 {
-	size_t			i;
-	t_type			type;
-	t_token			*first;
-	t_token			*cur;
-
-	i = 0;
-	first = create_new_token(NULL, &i, DUMMY, ms);
-	if (!first)
-		return (NULL);
-	cur = first;
-	while (str[i])
+	clean_token_list(&ms->tokens);
+	if (!pcache_lookup(ms, str))
 	{
-		type = define_token_type(str, i);
-		cur->next = create_new_token(str, &i, type, ms);
-		if (!cur->next)
-			return (clean_token_list(&first));
-		cur = cur->next;
+		if (!lex_line(str, ms))
+		{
+			clean_token_list(&ms->tokens);
+			return (0);
+		}
+		pcache_store(ms, str);
 	}
-	flags_for_redirections(first);
-	if (check_list_for_expansions(first, ms) == 1)
-		return (clean_token_list(&first));
-	first = unite_two_word_tokens(first, ms);
-	if (check_list_for_tilde(first, ms) == 1)
-		return (clean_token_list(&first));
-	return (first);
+	return (1);
 }
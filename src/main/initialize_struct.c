@@ -6,7 +6,7 @@
 /*   By: ssalorin <ssalorin@student.hive.fi>        +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/03/27 14:07:41 by ssalorin          #+#    #+#             */
-/*   Updated: 2025/03/27 14:07:43 by ssalorin         ###   ########.fr       */
+/*   Updated: 2026/10/17 02:31:20 by agent            ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -69,26 +69,28 @@ void	checking_pwds(t_ms *ms)
 /**
  * @brief Initializes the shell's history functionality.
  *
- * This function sets up the shell's history by calling `default_history` to 
- * set default values for the history list and initializing the history number. 
- * It then attempts to open the history file for reading. If the file is 
- * successfully opened, the history file flag is set. Otherwise, an error 
- * message is printed and the history file flag is set to false.
+ * This function limits the readline history to the default size and then 
+ * applies `HISTSIZE` from the environment, so it must run after the 
+ * environment has been imported. It then attempts to open the history file 
+ * for reading. If the file is successfully opened, the history file flag is 
+ * set. Otherwise, an error message is printed and the history file flag is 
+ * set to false. Script mode keeps no history, so readline and the history 
+ * file are left alone and startup stays cheap.
  *
  * @param ms The shell structure containing execution state, including the 
  *           history.
  */
 static void	initialize_history(t_ms *ms)
 {
-	default_history(ms->history);
-	ms->history_num = 0;
+	ms->history_file = false;
+	if (ms->script_mode)
+		return ;
+	stifle_history(HISTORY_SIZE);
+	history_settings(ms);
 	if (open_read_history_file(ms) == 0)
 		ms->history_file = true;
 	else
-	{
 		print_system_error(HIST_RD_ERR);
-		ms->history_file = false;
-	}
 }
 
 /**
@@ -98,21 +100,37 @@ static void	initialize_history(t_ms *ms)
  * This function sets each field of the `t_ms` structure to a NULL pointer or 
  * its appropriate default value (such as 0 for integer fields). It ensures 
  * that all fields are properly initialized before they are used in further
- * processing, preventing potential issues with uninitialized memory.
+ * processing, preventing potential issues with uninitialized memory. A 
+ * shell started with `-c` or a script file reads its commands from the 
+ * given reader and runs in script mode.
  *
  * @param ms The minishell structure to be initialized.
+ * @param reader The reader of a `-c` string or script, or NULL.
  */
-static void	initialize_to_null(t_ms *ms)
+static void	initialize_to_null(t_ms *ms, t_reader *reader)
 {
-	ms->tokens = NULL;
+	ft_memset(&ms->tokens, 0, sizeof(t_tokens));
+	ms->scan = lex_scanner();
+	ft_memset(&ms->pcache, 0, sizeof(t_pcache));
 	ms->blocks = NULL;
 	ms->cmds = NULL;
-	ms->envp = NULL;
-	ms->exported = NULL;
-	ms->heredoc_count = 0;
-	ms->heredoc_files = NULL;
+	ft_memset(&ms->env, 0, sizeof(t_env));
 	ms->pwd = NULL;
 	ms->unset_pwd_exp_old = false;
+	ms->reader = reader;
+	ms->script_mode = (reader != NULL);
+	default_history(&ms->hist);
+	ms->history_fd = -1;
+	ms->history_lines = 0;
+	ms->history_path = NULL;
+	ft_memset(ms->cmd_hash, 0, sizeof(ms->cmd_hash));
+	ft_memset(&ms->arena, 0, sizeof(t_arena));
+	ft_memset(&ms->heredocs, 0, sizeof(t_heredocs));
+	ft_memset(&ms->pipestatus, 0, sizeof(t_strbuf));
+	ft_memset(&ms->jobs, 0, sizeof(t_jobs));
+	ft_memset(&ms->line, 0, sizeof(t_line));
+	ft_memset(&ms->trace, 0, sizeof(t_trace));
+	ft_memset(&ms->timer, 0, sizeof(t_timer));
 }
 
 /**
@@ -125,11 +143,13 @@ static void	initialize_to_null(t_ms *ms)
  * resources, and exits the program.
  * 
  * @param envp The environment variables passed to the shell.
+ * @param reader The reader of a `-c` string or script, or NULL for the 
+ *               usual standard input.
  * 
  * @return A pointer to the initialized `t_ms` structure, or `NULL` if 
  *         allocation fails.
  */
-t_ms	*initialize_struct(char **envp)
+t_ms	*initialize_struct(char **envp, t_reader *reader)
 {
 	t_ms	*ms;
 	char	cwd[1024];
@@ -137,7 +157,7 @@ t_ms	*initialize_struct(char **envp)
 	ms = allocate_struct();
 	if (!ms)
 		return (NULL);
-	initialize_to_null(ms);
+	initialize_to_null(ms, reader);
 	if (getcwd(cwd, sizeof(cwd)) == NULL)
 	{
 		perror("getcwd failed");
@@ -151,9 +171,9 @@ t_ms	*initialize_struct(char **envp)
 		free(ms);
 		exit(1);
 	}
-	initialize_history(ms);
 	initialize_envp_and_exp(ms, envp);
 	update_shlvl(ms);
+	initialize_history(ms);
 	g_sgnl = 0;
 	return (ms);
 }
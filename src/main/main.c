@@ -6,7 +6,7 @@
 /*   By: ssalorin <ssalorin@student.hive.fi>        +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/03/27 14:07:23 by ssalorin          #+#    #+#             */
-/*   Updated: 2025/03/27 14:07:25 by ssalorin         ###   ########.fr       */
+/*   Updated: 2026/10/17 02:44:16 by agent            ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -15,75 +15,33 @@
 volatile sig_atomic_t	g_sgnl;
 
 /**
- * @brief Executes a list of commands.
+ * @brief Processes and parses the user input for execution.
  * 
- * This function processes a list of commands, determining whether to execute 
- * them as built-in functions or external commands. It handles the execution 
- * of a single command or multiple commands by creating child processes as 
- * needed.
- * 
- * If there is only one command and it is a built-in, it will be executed 
- * directly. If there are multiple commands, child processes will be created 
- * for each command to execute them in parallel. After executing the commands, 
- * it ensures file descriptors are closed and handles the appropriate exit 
- * statuses.
- * 
- * @param ms A pointer to the shell's main structure containing the command 
- *           list and other relevant state information.
- */
-static void	execute_commands(t_ms *ms)
-{
-	t_cmd	*cur;
-	int		i;
-
-	cur = ms->cmds;
-	i = 0;
-	while (cur)
-	{
-		cur = cur->next;
-		i++;
-	}
-	if (is_builtin(ms->cmds) && if_children_needed(ms->cmds) == false && i == 1)
-		handle_builtin(ms->cmds, ms);
-	else
-	{
-		if (i == 1)
-			make_one_child(ms->cmds, ms);
-		else
-			make_multiple_children(i, ms->cmds, ms);
-	}
-	close_every_cmds_fds(ms->cmds);
-}
-
-/**
- * @brief Processes and tokenizes the user input for execution.
- * 
- * This function applies multiple processing steps to the input, including 
- * initial validation, tokenization, and the creation of command structures. 
- * It also handles interruption signals and cleans up partially allocated 
- * data if necessary.
+ * This function applies the processing steps that concern the whole line: 
+ * initial validation, tokenization and parsing into a command list. The 
+ * commands of each pipeline are created later, right before it runs, 
+ * by `run_list`. Both steps are traced.
  * 
  * @param input A pointer to the user's input string.
  * @param ms A pointer to the main shell structure containing shell state.
  * 
- * @return 1 if processing is successful, 0 if an error occurs or an 
- *         interruption is detected.
+ * @return 1 if processing is successful, 0 if an error occurs or the line 
+ *         is empty.
  */
 static int	tokenize_and_process_input(char **input, t_ms *ms)
 {
+	long long	start;
+	int			ret;
+
+	arena_reset(&ms->arena);
+	start = trace_begin(ms);
 	if (!process_input(input, ms))
 		return (0);
-	if (!tokenize_input(input, ms))
-		return (0);
-	if (!create_blocks_and_cmds_lists(ms))
-		return (0);
-	if (g_sgnl == SIGINT)
-	{
-		clean_struct_partially(ms);
-		g_sgnl = 0;
-		return (0);
-	}
-	return (1);
+	trace_end(ms, "process", start, 0);
+	start = trace_begin(ms);
+	ret = tokenize_input(input, ms);
+	trace_end(ms, "tokenize", start, 0);
+	return (ret);
 }
 
 /**
@@ -123,10 +81,11 @@ static int	init_terminal_signals(void)
  * @brief Main loop for executing the minishell commands.
  * 
  * This function runs an interactive or non-interactive loop to read input, 
- * process it, tokenize the input, and execute the commands. It handles EOF 
- * detection (Ctrl+D), cleans up after each command execution, and continues 
- * running until the shell encounters a critical error (e.g., memory allocation 
- * failure or system error) or the user exits (Ctrl+D).
+ * process it, tokenize and parse the input, and run its command list. It 
+ * handles EOF detection (Ctrl+D), cleans up after each command execution, and 
+ * continues running until the shell encounters a critical error (e.g., memory 
+ * allocation failure or system error) or the user exits (Ctrl+D). In script 
+ * mode a syntax error ends the shell, as in bash.
  * 
  * @param ms A pointer to the `t_ms` structure, which holds the shell's state, 
  *           including the exit status and other shell-related data.
@@ -140,32 +99,24 @@ static void	run_minishell(t_ms *ms)
 
 	while (1)
 	{
-		if (ms->exit_status == MALLOC_ERR
-			|| ms->exit_status == SYSTEM_ERR)
+		if (ms->exit_status == MALLOC_ERR || ms->exit_status == SYSTEM_ERR
+			|| (ms->script_mode && ms->err == SYNTAX_ERR))
 			break ;
 		// FOR USUAL EXECUTION
 		/*signal_mode(INTERACTIVE);
 		input = readline("minishell> ");
 		signal_mode(IGNORE);*/
 		//FOR TESTER
-		if (isatty(fileno(stdin)))
-			input = readline("minishell> ");
-		else
-		{
-			char	*line = get_next_line(fileno(stdin));
-			if (!line)
-				break ;
-			input = ft_strtrim(line, "\n");
-			free(line);
-		}
+		jobs_notify(ms);
+		input = read_input_line(ms);
 		if (!input)
 		{
-			ft_putstr_fd("exit\n", STDOUT_FILENO);
+			if (!ms->reader)
+				ft_putstr_fd("exit\n", STDOUT_FILENO);
 			break ;
 		}
-		if (!tokenize_and_process_input(&input, ms))
-			continue ;
-		execute_commands(ms);
+		if (tokenize_and_process_input(&input, ms))
+			run_list(ms);
 		clean_struct_partially(ms);
 	}
 }
@@ -173,16 +124,17 @@ static void	run_minishell(t_ms *ms)
 /**
  * @brief Initializes and runs the minishell program.
  *
- * This function checks the argument count and ensures correct usage of the 
- * shell. It initializes terminal signals and the minishell structure, then 
+ * This function picks the shell's input from its arguments: standard input, 
+ * a `-c` command string or a script file. Only the first sets up the 
+ * terminal; the others skip it, like the history, to start fast. It 
+ * initializes the minishell structure, then 
  * runs the shell main loop (`run_minishell`). After execution, it cleans up 
  * resources like command lists, history, and the minishell structure. The 
  * function handles error codes and exits with the appropriate exit status 
  * based on the result of the execution.
  *
- * @param argc The argument count, expected to be 1 for proper usage.
- * @param argv The argument vector, not used in this case but required for 
- * standard `main` format.
+ * @param argc The argument count.
+ * @param argv The argument vector: nothing, `-c command` or a script.
  * @param envp The environment variables passed to the program, used for 
  * initialization.
  * @return The exit status of the program, either 1 on error or the exit 
@@ -190,24 +142,23 @@ static void	run_minishell(t_ms *ms)
  */
 int	main(int argc, char **argv, char **envp)
 {
-	t_ms	*ms;
-	int		exit_code;
+	t_ms		*ms;
+	t_reader	*reader;
+	int			exit_code;
 
-	if (argc != 1 && argv)
-	{
-		ft_putstr_fd("Usage: ./minishell\n", STDERR_FILENO);
-		return (1);
-	}
-	if (!init_terminal_signals())
+	reader = script_reader(argc, argv);
+	if (!reader && !init_terminal_signals())
 		return (1);
-	ms = initialize_struct(envp);
+	ms = initialize_struct(envp, reader);
 	run_minishell(ms);
 	clean_cmd_list(&(ms->cmds));
 	history_exit(ms);
 	exit_code = ms->exit_status;
 	if (exit_code == MALLOC_ERR || exit_code == SYSTEM_ERR)
 		exit_code = 1;
+	arena_report(&ms->arena);
 	clean_struct(ms);
 	rl_clear_history();
+	memstat_exit();
 	return (exit_code);
 }
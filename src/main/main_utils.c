@@ -6,103 +6,108 @@
 /*   By: ssalorin <ssalorin@student.hive.fi>        +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/03/27 14:07:32 by ssalorin          #+#    #+#             */
-/*   Updated: 2025/03/27 14:07:34 by ssalorin         ###   ########.fr       */
+/*   Updated: 2026/10/17 03:13:05 by agent            ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "../../include/minishell.h"
 
 /**
- * @brief Counts the number of heredoc tokens in the token list.
+ * @brief Counts the number of heredoc tokens in the token vector.
  * 
- * This function iterates through the token list and counts how many tokens 
+ * This function iterates through the token vector and counts how many tokens 
  * are of type `HEREDOC`. The function returns the total count of heredoc 
- * tokens in the list.
+ * tokens in the vector.
  * 
- * @param token A pointer to the head of the token list to be scanned.
+ * @param toks A pointer to the token vector to be scanned.
  * 
- * @return The number of heredoc tokens found in the list.
+ * @return The number of heredoc tokens found in the vector.
  */
-static int	count_heredocs(t_token *token)
+static size_t	count_heredocs(t_tokens *toks)
 {
-	t_token	*cur;
-	int		heredoc_count;
+	size_t	i;
+	size_t	heredoc_count;
 
-	cur = token;
+	i = 0;
 	heredoc_count = 0;
-	while (cur)
+	while (i < toks->len)
 	{
-		if (cur->type == HEREDOC)
+		if (toks->arr[i].type == HEREDOC)
 			heredoc_count++;
-		cur = cur->next;
+		i++;
 	}
 	return (heredoc_count);
 }
 
 /**
- * @brief Allocates memory for heredoc file paths and handles errors.
+ * @brief Enforces the maximum number of heredocs on one command line.
  * 
- * This function calculates the number of heredocs from the given token list 
- * and allocates memory for storing the paths to the heredoc files in the 
- * `ms->heredoc_files` array. If the number of heredocs exceeds the maximum 
- * allowed (16), an error message is printed, and the program exits. If memory 
- * allocation fails, a malloc error is printed, and the program exits. 
- * Otherwise, the function initializes the `ms->heredoc_files` array with NULL 
- * values.
+ * This function counts the heredocs in the given token list. If the number 
+ * of heredocs exceeds the ceiling returned by `heredoc_ceiling`, an error 
+ * message is printed and the exit status is set to 2, like bash does. Only 
+ * the current line is abandoned; the shell keeps running. Its heredoc 
+ * bodies are still read and dropped, so their lines are not taken for 
+ * commands. Otherwise the bodies are read once the whole line is parsed.
  * 
- * @param ms A pointer to the main shell structure, which will store the heredoc
- *           file paths.
- * @param token A pointer to the token list, which is used to count the heredocs.
+ * @param ms A pointer to the main shell structure.
+ * @param toks A pointer to the token vector, used to count the heredocs.
+ * 
+ * @return 1 if the line is within the limit, 0 if it exceeds it.
  */
-static void	malloc_heredocs(t_ms *ms, t_token *token)
+static int	check_heredoc_limit(t_ms *ms, t_tokens *toks)
 {
-	int		heredoc_count;
-
-	heredoc_count = count_heredocs(token);
-	if (heredoc_count > 16)
+	if (count_heredocs(toks) > heredoc_ceiling(ms))
 	{
 		ft_putstr_fd(OWN_ERR_MSG, STDERR_FILENO);
 		ft_putstr_fd(HEREDOC_ERR, STDERR_FILENO);
-		clean_ms_history(ms);
-		clean_struct(ms);
-		exit(2);
-	}
-	ms->heredoc_files = malloc(sizeof(char *) * (heredoc_count + 1));
-	if (!ms->heredoc_files)
-	{
-		print_malloc_set_status(ms);
-		clean_ms_history(ms);
-		clean_struct(ms);
-		exit(1);
+		read_heredocs(ms, toks);
+		ms->exit_status = 2;
+		return (0);
 	}
-	ft_memset(ms->heredoc_files, 0, sizeof(char *) * (heredoc_count + 1));
-	ms->heredoc_files[0] = NULL;
+	return (1);
 }
 
 /**
- * @brief Tokenizes the input string and processes redirections and heredocs.
+ * @brief Tokenizes and parses the input string and checks the heredoc limit.
  * 
- * This function tokenizes the given input string and stores the tokens in the 
- * `ms->tokens` structure. If tokenization fails, it prints an error message and 
- * returns 0. It also frees the original input string after tokenization. After 
- * tokenization, it processes heredocs and sets up files for redirections.
+ * This function tokenizes the given input string and moves the raw tokens 
+ * to `ms->line`, where `parse_list` builds the command list from them. The 
+ * lexer validates the syntax in the same pass, so a syntax error has 
+ * already been reported when it returns NULL with `ms->err` set to 
+ * SYNTAX_ERR; the exit status is then set to 2. Any other failure prints an 
+ * error message. The tokens point into the input string, so on success it 
+ * is kept in `ms->line` until the whole line has run. The bodies of all 
+ * heredocs on the line are then read by `read_heredocs`.
  * 
  * @param input A pointer to the input string to be tokenized.
  * @param ms A pointer to the main shell structure, which holds the tokens.
- * @return 1 if tokenization is successful, 0 if there is an error.
+ * @return 1 if tokenization is successful, 0 if there is an error, the 
+ *         line has too many heredocs or a heredoc was interrupted.
  */
 int	tokenize_input(char **input, t_ms *ms)
 {
-	ms->tokens = tokenization(*input, ms);
-	free(*input);
-	if (!ms->tokens)
+	t_tokens	raw;
+
+	ms->err = 0;
+	if (!tokenization(*input, ms))
 	{
-		ft_putstr_fd(TOKENS_ERR, STDERR_FILENO);
+		free(*input);
+		if (ms->err == SYNTAX_ERR)
+			ms->exit_status = 2;
+		else
+			ft_putstr_fd(TOKENS_ERR, STDERR_FILENO);
 		return (0);
 	}
-	malloc_heredocs(ms, ms->tokens);
-	put_files_for_redirections(ms->tokens, ms);
-	return (1);
+	ms->line.text = *input;
+	if (!check_heredoc_limit(ms, &ms->tokens))
+		return (0);
+	raw = ms->line.toks;
+	ms->line.toks = ms->tokens;
+	ms->tokens = raw;
+	ms->line.list = parse_list(ms, &ms->line.toks);
+	if (!ms->line.list)
+		return (0);
+	return (read_heredocs(ms, &ms->line.toks));
 }
 
 /**
@@ -121,18 +126,18 @@ int	tokenize_input(char **input, t_ms *ms)
 int	create_blocks_and_cmds_lists(t_ms *ms)
 {
 	ms->err = 0;
-	ms->blocks = create_blocks_list(ms, ms->tokens, NULL);
+	ms->blocks = create_blocks_list(ms, &ms->tokens);
 	if (ms->err)
 	{
 		ft_putstr_fd(BLOCKS_ERR, STDERR_FILENO);
-		clean_token_list(&(ms->tokens));
+		clean_token_list(&ms->tokens);
 		return (0);
 	}
 	ms->cmds = create_cmd_list(ms->blocks, ms);
 	if (!ms->cmds)
 	{
 		ft_putstr_fd(CMDS_ERR, STDERR_FILENO);
-		clean_token_list(&(ms->tokens));
+		clean_token_list(&ms->tokens);
 		clean_block_list(&(ms->blocks));
 		return (0);
 	}
@@ -140,12 +145,12 @@ int	create_blocks_and_cmds_lists(t_ms *ms)
 }
 
 /**
- * @brief Processes user input for syntax validation and history addition.
+ * @brief Processes user input before tokenization and adds it to history.
  * 
- * This function checks if the input is empty or contains syntax errors. 
- * If the input is empty (i.e., only Enter was pressed), it is ignored.
- * If a syntax error is found, the error code is set and the input is discarded. 
- * Otherwise, the input is added to the history.
+ * This function checks if the input is empty. If the input is empty (i.e., 
+ * only Enter was pressed), it is ignored. Otherwise, the input is added to the 
+ * history, unless the shell runs a `-c` string or a script. Syntax errors are 
+ * reported later by the lexer.
  * 
  * @param input A pointer to the string containing the user input.
  * @param ms A pointer to the main shell structure, used to store the 
@@ -155,9 +160,6 @@ int	create_blocks_and_cmds_lists(t_ms *ms)
  */
 int	process_input(char **input, t_ms *ms)
 {
-	int		err_syntax;
-
-	err_syntax = 0;
 	if (g_sgnl == SIGINT)
 	{
 		ms->exit_status = 130;
@@ -168,13 +170,7 @@ int	process_input(char **input, t_ms *ms)
 		free(*input);
 		return (0);
 	}
-	add_line_to_history(*input, ms);
-	err_syntax = validate_input(*input);
-	if (err_syntax)
-	{
-		free(*input);
-		ms->exit_status = 2;
-		return (0);
-	}
+	if (!ms->script_mode)
+		add_line_to_history(*input, ms);
 	return (1);
 }
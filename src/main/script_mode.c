@@ -0,0 +1,146 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   script_mode.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: agent <agent@local>                        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 02:26:41 by agent             #+#    #+#             */
+/*   Updated: 2026/10/17 02:26:41 by agent            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../include/minishell.h"
+#include <errno.h>
+
+/**
+ * @brief Prints an error about the command line of the shell itself.
+ * 
+ * @param what The argument at fault.
+ * @param msg The message printed after it.
+ */
+static void	script_error(char *what, char *msg)
+{
+	ft_putstr_fd(OWN_ERR_MSG, STDERR_FILENO);
+	ft_putstr_fd(what, STDERR_FILENO);
+	ft_putstr_fd(msg, STDERR_FILENO);
+}
+
+/**
+ * @brief Reports a bad option with the usage and exits with status 2.
+ * 
+ * @param opt The option at fault.
+ */
+static void	usage_error(char *opt)
+{
+	if (ft_strcmp(opt, "-c") == 0)
+		script_error(opt, ": " OPT_ARG_ERR);
+	else
+		script_error(opt, ": " OPT_ERR);
+	ft_putstr_fd(MS_USAGE, STDERR_FILENO);
+	exit(2);
+}
+
+/**
+ * @brief Creates a line reader over the string given to `-c`.
+ * 
+ * The whole input is already in memory, so the buffer is a copy of the 
+ * string and the reader is at end of input from the start; it never reads 
+ * from a file descriptor.
+ * 
+ * @param cmd The command string.
+ * 
+ * @return The new reader, or NULL if an allocation fails.
+ */
+static t_reader	*string_reader(char *cmd)
+{
+	t_reader	*reader;
+
+	reader = malloc(sizeof(t_reader));
+	if (!reader)
+		return (NULL);
+	reader->buf = ft_strdup(cmd);
+	if (!reader->buf)
+	{
+		free(reader);
+		return (NULL);
+	}
+	reader->fd = -1;
+	reader->end = ft_strlen(cmd);
+	reader->cap = reader->end + 1;
+	reader->start = 0;
+	reader->eof = true;
+	return (reader);
+}
+
+/**
+ * @brief Opens a script file, or exits like bash when it cannot be read.
+ * 
+ * A missing file ends the shell with status 127, a directory or a file 
+ * without read permission with 126. The descriptor is close-on-exec, so 
+ * commands started by the script do not inherit it.
+ * 
+ * @param path The path of the script.
+ * 
+ * @return The open file descriptor.
+ */
+static int	open_script(char *path)
+{
+	int			fd;
+	struct stat	st;
+
+	fd = open(path, O_RDONLY | O_CLOEXEC);
+	if (fd >= 0 && fstat(fd, &st) == 0 && S_ISDIR(st.st_mode))
+	{
+		close(fd);
+		script_error(path, IS_DIR_ERR);
+		exit(126);
+	}
+	if (fd < 0 && errno == EACCES)
+	{
+		script_error(path, PERM_DEN_ERR);
+		exit(126);
+	}
+	if (fd < 0)
+	{
+		script_error(path, NO_FD_ERR);
+		exit(127);
+	}
+	return (fd);
+}
+
+/**
+ * @brief Chooses the input of the shell from its arguments.
+ * 
+ * Without arguments the shell reads standard input as before. With 
+ * `-c command` it runs the command string, and with a file name it runs 
+ * the file; either way it runs in script mode. Any further arguments are 
+ * accepted and ignored, as the shell has no positional parameters. A bad 
+ * option ends the shell with status 2.
+ * 
+ * @param argc The argument count.
+ * @param argv The argument vector.
+ * 
+ * @return The reader of the command string or script, or NULL to read 
+ *         standard input.
+ */
+t_reader	*script_reader(int argc, char **argv)
+{
+	t_reader	*reader;
+
+	if (argc < 2)
+		return (NULL);
+	reader = NULL;
+	if (ft_strcmp(argv[1], "-c") == 0 && argc > 2)
+		reader = string_reader(argv[2]);
+	else if (argv[1][0] != '-')
+		reader = reader_init(open_script(argv[1]));
+	else
+		usage_error(argv[1]);
+	if (!reader)
+	{
+		script_error("", ERR_MALLOC);
+		exit(1);
+	}
+	return (reader);
+}
@@ -6,7 +6,7 @@
 /*   By: ssalorin <ssalorin@student.hive.fi>        +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/03/27 14:08:01 by ssalorin          #+#    #+#             */
-/*   Updated: 2025/03/27 14:08:03 by ssalorin         ###   ########.fr       */
+/*   Updated: 2026/10/17 01:18:03 by agent            ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -87,16 +87,16 @@ static char	*increase_shlvl(char *shlvl_value, int *printed_warning)
 /**
  * @brief Modifies the `SHLVL` environment variable by increasing its value.
  * 
- * This function searches for the `SHLVL` variable in the environment and 
+ * This function looks up the `SHLVL` variable in the environment store and 
  * updates it accordingly. It ensures that:
  * - `SHLVL` is properly incremented using `increase_shlvl()`.
- * - The new value is allocated dynamically and replaces the old entry.
+ * - The new value is allocated dynamically and replaces the old one.
  * - If `SHLVL` is too high, it handles the reset and warning logic.
- * - If `SHLVL` is not found, the function returns 0 (indicating no 
+ * - If `SHLVL` is not set, the function returns 0 (indicating no 
  *   modification was made).
  * 
- * @param env A pointer to the environment variable array (`char ***`), where 
- *            `SHLVL` will be updated in place.
+ * @param env A pointer to the environment store, where `SHLVL` will be 
+ *            updated in place.
  * @param printed_warning A pointer to an integer flag used to track whether a 
  *                        warning about a high `SHLVL` has already been printed.
  * 
@@ -105,31 +105,23 @@ static char	*increase_shlvl(char *shlvl_value, int *printed_warning)
  *         - `0` if `SHLVL` was not found in the environment.
  *         - `2` if a memory allocation failure occurred.
  */
-static int	modify_shlvl(char ***env, int *printed_warning)
+static int	modify_shlvl(t_env *env, int *printed_warning)
 {
-	int		i;
+	t_var	*var;
 	char	*new_value;
-	char	*temp;
+	int		ret;
 
-	i = 0;
-	while ((*env)[i])
-	{
-		if (ft_strncmp((*env)[i], "SHLVL=", 6) == 0)
-		{
-			new_value = increase_shlvl((*env)[i] + 6, printed_warning);
-			if (!new_value)
-				return (2);
-			temp = ft_strjoin("SHLVL=", new_value);
-			free(new_value);
-			if (!temp)
-				return (2);
-			free((*env)[i]);
-			(*env)[i] = temp;
-			return (1);
-		}
-		i++;
-	}
-	return (0);
+	var = env_get(env, "SHLVL");
+	if (!var || !var->value)
+		return (0);
+	new_value = increase_shlvl(var->value, printed_warning);
+	if (!new_value)
+		return (2);
+	ret = env_set(env, "SHLVL", new_value);
+	free(new_value);
+	if (!ret)
+		return (2);
+	return (1);
 }
 
 /**
@@ -174,11 +166,10 @@ static void	make_args(char ***args, t_ms *ms)
 }
 
 /**
- * @brief Updates the `SHLVL` environment variable in both the environment 
- *        and exported variables.
+ * @brief Updates the `SHLVL` environment variable.
  * 
  * This function checks and modifies the `SHLVL` variable in the environment 
- * (`ms->envp`). If the `SHLVL` is found, it is incremented using 
+ * store (`ms->env`). If the `SHLVL` is found, it is incremented using 
  * `modify_shlvl()`. 
  * - If the `SHLVL` variable does not exist, a new variable is created and 
  *   exported using `handle_export()`.
@@ -200,13 +191,13 @@ void	update_shlvl(t_ms *ms)
 	printed_warning = 0;
 	if (ms->exit_status == MALLOC_ERR)
 		return ;
-	check = modify_shlvl(&ms->envp, &printed_warning);
+	check = modify_shlvl(&ms->env, &printed_warning);
 	if (check == 2)
 	{
 		print_malloc_set_status(ms);
 		return ;
 	}
-	else if (check == 0)
+	if (check == 0)
 	{
 		make_args(&args, ms);
 		if (ms->exit_status == MALLOC_ERR)
@@ -214,6 +205,4 @@ void	update_shlvl(t_ms *ms)
 		handle_export(args, ms);
 		clean_arr(&args);
 	}
-	else
-		modify_shlvl(&ms->exported, &printed_warning);
 }
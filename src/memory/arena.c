@@ -0,0 +1,168 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   arena.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: agent <agent@local>                        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 01:08:57 by agent             #+#    #+#             */
+/*   Updated: 2026/10/17 03:06:21 by agent            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../include/minishell.h"
+
+/**
+ * @brief Allocates a new chunk and appends it to the arena's chunk list.
+ * 
+ * The chunk header and its storage come from a single `malloc`. Chunks are 
+ * `ARENA_CHUNK` bytes unless one allocation needs more.
+ * 
+ * @param arena A pointer to the arena.
+ * @param min The number of bytes the chunk has to fit at least.
+ * 
+ * @return A pointer to the new chunk, or NULL if the allocation failed.
+ */
+static t_chunk	*arena_new_chunk(t_arena *arena, size_t min)
+{
+	t_chunk	*chunk;
+	t_chunk	*last;
+	size_t	size;
+
+	size = ARENA_CHUNK;
+	if (min > size)
+		size = min;
+	chunk = malloc(sizeof(t_chunk) + size);
+	if (!chunk)
+		return (NULL);
+	chunk->data = (char *)(chunk + 1);
+	chunk->size = size;
+	chunk->used = 0;
+	chunk->next = NULL;
+	arena->chunks++;
+	if (!arena->head)
+		arena->head = chunk;
+	else
+	{
+		last = arena->cur;
+		while (last->next)
+			last = last->next;
+		last->next = chunk;
+	}
+	return (chunk);
+}
+
+/**
+ * @brief Allocates memory for the current command line from the arena.
+ * 
+ * The memory stays valid until the next `arena_reset` and must never be 
+ * passed to `free`. Sizes are rounded up to `ARENA_ALIGN` so that any 
+ * structure can be placed in the returned block.
+ * 
+ * @param ms A pointer to the shell structure owning the arena.
+ * @param size The number of bytes to allocate.
+ * 
+ * @return A pointer to the memory, or NULL if a new chunk could not be 
+ *         allocated (the malloc error is reported).
+ */
+void	*arena_alloc(t_ms *ms, size_t size)
+{
+	t_chunk	*chunk;
+	void	*ptr;
+
+	size = (size + ARENA_ALIGN - 1) & ~((size_t)ARENA_ALIGN - 1);
+	chunk = ms->arena.cur;
+	while (chunk && chunk->used + size > chunk->size)
+		chunk = chunk->next;
+	if (!chunk)
+	{
+		chunk = arena_new_chunk(&ms->arena, size);
+		if (!chunk)
+			return (print_malloc_set_status(ms));
+	}
+	ms->arena.cur = chunk;
+	ptr = chunk->data + chunk->used;
+	chunk->used += size;
+	ms->arena.allocs++;
+	return (ptr);
+}
+
+/**
+ * @brief Releases everything allocated for the previous command line.
+ * 
+ * The first chunk of the standard `ARENA_CHUNK` size is kept and marked 
+ * empty, so a typical line is served without calling `malloc` at all. Every 
+ * other chunk is freed, so one huge line does not pin its memory for the 
+ * rest of the session.
+ * 
+ * @param arena A pointer to the arena to reset.
+ */
+void	arena_reset(t_arena *arena)
+{
+	t_chunk	*chunk;
+	t_chunk	*next;
+	t_chunk	*keep;
+
+	keep = NULL;
+	chunk = arena->head;
+	while (chunk)
+	{
+		next = chunk->next;
+		if (!keep && chunk->size == ARENA_CHUNK)
+			keep = chunk;
+		else
+			free(chunk);
+		chunk = next;
+	}
+	if (keep)
+	{
+		keep->used = 0;
+		keep->next = NULL;
+	}
+	arena->head = keep;
+	arena->cur = keep;
+	arena->resets++;
+}
+
+/**
+ * @brief Frees every chunk of the arena.
+ * 
+ * @param arena A pointer to the arena to free.
+ */
+void	arena_free(t_arena *arena)
+{
+	t_chunk	*chunk;
+	t_chunk	*next;
+
+	chunk = arena->head;
+	while (chunk)
+	{
+		next = chunk->next;
+		free(chunk);
+		chunk = next;
+	}
+	arena->head = NULL;
+	arena->cur = NULL;
+}
+
+/**
+ * @brief Prints the arena's allocation counters to `stderr`.
+ * 
+ * Shows how many allocations the arena served and how many of them really 
+ * reached `malloc`. Called when the shell exits; nothing is printed unless 
+ * `MINISHELL_ARENA_STATS` is set in the environment.
+ * 
+ * @param arena A pointer to the arena.
+ */
+void	arena_report(t_arena *arena)
+{
+	if (!getenv("MINISHELL_ARENA_STATS"))
+		return ;
+	ft_putstr_fd("arena: ", STDERR_FILENO);
+	ft_putnbr_fd((int)arena->allocs, STDERR_FILENO);
+	ft_putstr_fd(" allocations served by ", STDERR_FILENO);
+	ft_putnbr_fd((int)arena->chunks, STDERR_FILENO);
+	ft_putstr_fd(" chunk mallocs over ", STDERR_FILENO);
+	ft_putnbr_fd((int)arena->resets, STDERR_FILENO);
+	ft_putstr_fd(" resets\n", STDERR_FILENO);
+}
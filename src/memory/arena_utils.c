@@ -0,0 +1,72 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   arena_utils.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: agent <agent@local>                        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 01:08:57 by agent             #+#    #+#             */
+/*   Updated: 2026/10/17 01:08:57 by agent            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../include/minishell.h"
+
+/**
+ * @brief Copies the first `n` characters of a string into the arena.
+ * 
+ * @param ms A pointer to the shell structure owning the arena.
+ * @param s The string to copy from.
+ * @param n The number of characters to copy.
+ * 
+ * @return The null-terminated copy, or NULL if the allocation failed.
+ */
+char	*arena_strndup(t_ms *ms, const char *s, size_t n)
+{
+	char	*copy;
+
+	copy = arena_alloc(ms, n + 1);
+	if (!copy)
+		return (NULL);
+	ft_memcpy(copy, s, n);
+	copy[n] = '\0';
+	return (copy);
+}
+
+/**
+ * @brief Copies a string into the arena.
+ * 
+ * @param ms A pointer to the shell structure owning the arena.
+ * @param s The string to copy.
+ * 
+ * @return The copy, or NULL if the allocation failed.
+ */
+char	*arena_strdup(t_ms *ms, const char *s)
+{
+	return (arena_strndup(ms, s, ft_strlen(s)));
+}
+
+/**
+ * @brief Joins two strings into a new string allocated in the arena.
+ * 
+ * @param ms A pointer to the shell structure owning the arena.
+ * @param s1 The first string.
+ * @param s2 The string appended to `s1`.
+ * 
+ * @return The joined string, or NULL if the allocation failed.
+ */
+char	*arena_strjoin(t_ms *ms, const char *s1, const char *s2)
+{
+	char	*joined;
+	size_t	len1;
+	size_t	len2;
+
+	len1 = ft_strlen(s1);
+	len2 = ft_strlen(s2);
+	joined = arena_alloc(ms, len1 + len2 + 1);
+	if (!joined)
+		return (NULL);
+	ft_memcpy(joined, s1, len1);
+	ft_memcpy(joined + len1, s2, len2 + 1);
+	return (joined);
+}
@@ -0,0 +1,161 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   memstat.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: agent <agent@local>                        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 02:44:16 by agent             #+#    #+#             */
+/*   Updated: 2026/10/17 02:44:16 by agent            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <malloc.h>
+#include "../../include/minishell.h"
+
+#undef malloc
+#undef free
+
+/**
+ * @brief Returns the allocation accounting state.
+ * 
+ * The state lives outside `t_ms`, because the shell allocates before that 
+ * structure exists and frees it last.
+ * 
+ * @return A pointer to the process-wide accounting state.
+ */
+t_memstat	*memstat_state(void)
+{
+	static t_memstat	st;
+
+	return (&st);
+}
+
+/**
+ * @brief Tells which subsystem a source file belongs to.
+ * 
+ * @param file The source file of a call site, as given by `__FILE__`.
+ * 
+ * @return The subsystem, `SUB_OTHER` if none matches.
+ */
+static t_memsub	subsystem_of(const char *file)
+{
+	static const char		*dirs[] = {"/lexer/", "/parser/", "/envp/env_",
+		"/builtins/export", "/builtins/unset", "/main/initialization_",
+		"/envp/", "/reading/history", "/execution/", "/redirection/",
+		"/jobs/", "/memory/", NULL};
+	static const t_memsub	subs[] = {SUB_LEXER, SUB_PARSER, SUB_ENV,
+		SUB_ENV, SUB_ENV, SUB_ENV, SUB_EXPANSION, SUB_HISTORY, SUB_EXEC,
+		SUB_EXEC, SUB_EXEC, SUB_MEMORY};
+	int						i;
+
+	i = 0;
+	while (dirs[i] && !ft_strnstr(file, dirs[i], ft_strlen(file)))
+		i++;
+	if (!dirs[i])
+		return (SUB_OTHER);
+	return (subs[i]);
+}
+
+/**
+ * @brief Finds or adds the record of a call site.
+ * 
+ * Sites are kept in insertion order and found through an open addressing 
+ * table keyed by file and line.
+ * 
+ * @param st A pointer to the accounting state.
+ * @param file The source file of the call site.
+ * @param line The line of the call site.
+ * 
+ * @return The site's record, or NULL once `MEMSTAT_SITES` sites are known.
+ */
+static t_site	*find_site(t_memstat *st, const char *file, int line)
+{
+	size_t	slot;
+	t_site	*site;
+
+	slot = ((uintptr_t)file / 8 + (size_t)line * 31) % MEMSTAT_SLOTS;
+	while (st->slots[slot])
+	{
+		site = &st->sites[st->slots[slot] - 1];
+		if (site->line == line
+			&& (site->file == file || ft_strcmp(site->file, file) == 0))
+			return (site);
+		slot = (slot + 1) % MEMSTAT_SLOTS;
+	}
+	if (st->nsites == MEMSTAT_SITES)
+		return (NULL);
+	site = &st->sites[st->nsites++];
+	st->slots[slot] = st->nsites;
+	site->file = file;
+	site->line = line;
+	site->sub = subsystem_of(file);
+	return (site);
+}
+
+/**
+ * @brief Adds one allocation to its site and subsystem.
+ * 
+ * The last slot of the live and peak counters is the total. The first 
+ * allocation also records the shell's process id, which tells the shell apart 
+ * from its forked children at exit.
+ * 
+ * @param st A pointer to the accounting state.
+ * @param site A pointer to the call site.
+ * @param size The usable size of the block.
+ */
+static void	account(t_memstat *st, t_site *site, size_t size)
+{
+	if (!st->pid)
+		st->pid = getpid();
+	site->allocs++;
+	site->bytes += size;
+	site->live += size;
+	st->live[site->sub] += size;
+	if (st->live[site->sub] > st->peak[site->sub])
+		st->peak[site->sub] = st->live[site->sub];
+	st->live[SUB_COUNT] += size;
+	if (st->live[SUB_COUNT] > st->peak[SUB_COUNT])
+		st->peak[SUB_COUNT] = st->live[SUB_COUNT];
+}
+
+/**
+ * @brief Records a block allocated at a call site.
+ * 
+ * Blocks are counted by their usable size, what they really take from the 
+ * heap. A record left for the same address, by a block freed where the 
+ * accounting could not see it, is dropped first.
+ * 
+ * @param ptr The new block, or NULL.
+ * @param file The source file of the call site.
+ * @param line The line of the call site.
+ * 
+ * @return `ptr`, so allocating calls can be wrapped.
+ */
+void	*memstat_keep(void *ptr, const char *file, int line)
+{
+	t_memstat	*st;
+	t_mblock	*block;
+	size_t		bucket;
+
+	if (!ptr)
+		return (NULL);
+	st = memstat_state();
+	memstat_forget(st, ptr);
+	block = (t_mblock *)malloc(sizeof(t_mblock));
+	if (!block)
+		return (ptr);
+	block->site = find_site(st, file, line);
+	if (!block->site)
+	{
+		free(block);
+		return (ptr);
+	}
+	block->ptr = ptr;
+	block->size = malloc_usable_size(ptr);
+	bucket = ((uintptr_t)ptr >> 4) % MEMSTAT_BUCKETS;
+	block->next = st->blocks[bucket];
+	st->blocks[bucket] = block;
+	account(st, block->site, block->size);
+	return (ptr);
+}
@@ -0,0 +1,114 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   memstat_free.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: agent <agent@local>                        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 02:44:16 by agent             #+#    #+#             */
+/*   Updated: 2026/10/17 02:44:16 by agent            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../include/minishell.h"
+
+#undef malloc
+#undef free
+
+/**
+ * @brief Drops the record of a block, if there is one.
+ * 
+ * Blocks the shell did not allocate itself, such as the lines returned by 
+ * `readline`, have no record and are left alone.
+ * 
+ * @param st A pointer to the accounting state.
+ * @param ptr The block.
+ */
+void	memstat_forget(t_memstat *st, void *ptr)
+{
+	t_mblock	**link;
+	t_mblock	*block;
+
+	link = &st->blocks[((uintptr_t)ptr >> 4) % MEMSTAT_BUCKETS];
+	while (*link && (*link)->ptr != ptr)
+		link = &(*link)->next;
+	block = *link;
+	if (!block)
+		return ;
+	*link = block->next;
+	block->site->live -= block->size;
+	st->live[block->site->sub] -= block->size;
+	st->live[SUB_COUNT] -= block->size;
+	free(block);
+}
+
+/**
+ * @brief Allocates memory and records it at the call site.
+ * 
+ * @param size The number of bytes to allocate.
+ * @param file The source file of the call site.
+ * @param line The line of the call site.
+ * 
+ * @return The new block, or NULL if `malloc` failed.
+ */
+void	*memstat_malloc(size_t size, const char *file, int line)
+{
+	return (memstat_keep(malloc(size), file, line));
+}
+
+/**
+ * @brief Frees a block and drops its record.
+ * 
+ * @param ptr The block to free, or NULL.
+ */
+void	memstat_free(void *ptr)
+{
+	if (ptr)
+		memstat_forget(memstat_state(), ptr);
+	free(ptr);
+}
+
+/**
+ * @brief Records an array returned by `ft_split` and each of its strings.
+ * 
+ * @param arr The array, or NULL.
+ * @param file The source file of the call site.
+ * @param line The line of the call site.
+ * 
+ * @return `arr`.
+ */
+char	**memstat_split(char **arr, const char *file, int line)
+{
+	size_t	i;
+
+	i = 0;
+	while (arr && arr[i])
+		memstat_keep(arr[i++], file, line);
+	return ((char **)memstat_keep(arr, file, line));
+}
+
+/**
+ * @brief Frees the records of the blocks still alive.
+ * 
+ * Called once the report is written at exit, so the records themselves do 
+ * not show up as leaks.
+ */
+void	memstat_release(void)
+{
+	t_memstat	*st;
+	t_mblock	*block;
+	size_t		i;
+
+	st = memstat_state();
+	i = 0;
+	while (i < MEMSTAT_BUCKETS)
+	{
+		while (st->blocks[i])
+		{
+			block = st->blocks[i];
+			st->blocks[i] = block->next;
+			free(block);
+		}
+		i++;
+	}
+}
@@ -0,0 +1,148 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   memstat_report.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: agent <agent@local>                        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 02:44:16 by agent             #+#    #+#             */
+/*   Updated: 2026/10/17 02:44:16 by agent            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../include/minishell.h"
+
+/**
+ * @brief Writes a byte or call count followed by a separator.
+ * 
+ * @param fd The file descriptor to write to.
+ * @param n The number.
+ * @param sep The separator written after it.
+ */
+static void	put_num(int fd, size_t n, char *sep)
+{
+	char	buf[24];
+	int		i;
+
+	i = 23;
+	buf[i] = '\0';
+	if (n == 0)
+		buf[--i] = '0';
+	while (n > 0)
+	{
+		buf[--i] = '0' + n % 10;
+		n /= 10;
+	}
+	ft_putstr_fd(buf + i, fd);
+	ft_putstr_fd(sep, fd);
+}
+
+/**
+ * @brief Writes the row of one subsystem, or of all of them.
+ * 
+ * Live and peak bytes are tracked as blocks come and go; the number of 
+ * allocations and the bytes allocated in total are summed over the sites.
+ * 
+ * @param st A pointer to the accounting state.
+ * @param fd The file descriptor to write to.
+ * @param sub The subsystem, or `SUB_COUNT` for the total.
+ * @param name The name of the row.
+ */
+static void	report_sub(t_memstat *st, int fd, int sub, const char *name)
+{
+	size_t	allocs;
+	size_t	bytes;
+	int		i;
+
+	allocs = 0;
+	bytes = 0;
+	i = -1;
+	while (++i < st->nsites)
+	{
+		if (sub == SUB_COUNT || st->sites[i].sub == (t_memsub)sub)
+		{
+			allocs += st->sites[i].allocs;
+			bytes += st->sites[i].bytes;
+		}
+	}
+	ft_printf(fd, "%s\t", name);
+	put_num(fd, st->live[sub], "\t");
+	put_num(fd, st->peak[sub], "\t");
+	put_num(fd, allocs, "\t");
+	put_num(fd, bytes, "\n");
+}
+
+/**
+ * @brief Writes one row per call site, in the order they were first used.
+ * 
+ * @param fd The file descriptor to write to.
+ * @param names The names of the subsystems.
+ * @param live_only Whether to skip the sites that hold no memory.
+ */
+static void	report_sites(int fd, const char **names, t_bool live_only)
+{
+	t_memstat	*st;
+	t_site		*site;
+	int			i;
+
+	st = memstat_state();
+	ft_putstr_fd("site\tsubsystem\tallocs\tbytes\tlive\n", fd);
+	i = 0;
+	while (i < st->nsites)
+	{
+		site = &st->sites[i++];
+		if (live_only && !site->live)
+			continue ;
+		ft_printf(fd, "%s:%d\t%s\t", site->file, site->line, names[site->sub]);
+		put_num(fd, site->allocs, "\t");
+		put_num(fd, site->bytes, "\t");
+		put_num(fd, site->live, "\n");
+	}
+}
+
+/**
+ * @brief Writes the allocation accounting as tab-separated tables.
+ * 
+ * The first table has a row per subsystem and a total. The arena and the 
+ * string builders, which serve the lexer, the parser and the expansion, have 
+ * their own `memory` row. The columns are live and peak bytes, allocations, 
+ * and bytes allocated overall. The second, if asked for, has a row per call 
+ * site.
+ * 
+ * @param fd The file descriptor to write to.
+ * @param sites `MEMSTAT_NO_SITES`, `MEMSTAT_ALL_SITES`, or 
+ *              `MEMSTAT_LIVE_SITES` for the sites still holding memory.
+ */
+void	memstat_dump(int fd, int sites)
+{
+	static const char	*names[] = {"lexer", "parser", "expansion", "env",
+		"history", "exec", "memory", "other", "total"};
+	t_memstat			*st;
+	int					sub;
+
+	st = memstat_state();
+	ft_putstr_fd("subsystem\tlive\tpeak\tallocs\tbytes\n", fd);
+	sub = 0;
+	while (sub <= SUB_COUNT)
+	{
+		report_sub(st, fd, sub, names[sub]);
+		sub++;
+	}
+	if (sites != MEMSTAT_NO_SITES)
+		report_sites(fd, names, sites == MEMSTAT_LIVE_SITES);
+}
+
+/**
+ * @brief Reports the allocations when the shell exits.
+ * 
+ * Only in a `MEMSTAT` build, and not in a forked child that exits. It is 
+ * called after the shell has freed its state, so the live bytes left, and 
+ * the sites listed, are leaks.
+ */
+void	memstat_exit(void)
+{
+	if (!MEMSTAT_ON || memstat_state()->pid != getpid())
+		return ;
+	memstat_dump(STDERR_FILENO, MEMSTAT_LIVE_SITES);
+	memstat_release();
+}
@@ -0,0 +1,122 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   strbuf.c                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: agent <agent@local>                        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 01:11:08 by agent             #+#    #+#             */
+/*   Updated: 2026/10/17 01:11:08 by agent            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../include/minishell.h"
+
+/**
+ * @brief Makes sure the builder can hold `need` more bytes plus a terminator.
+ * 
+ * The capacity is doubled until it fits, so appending N bytes one piece at 
+ * a time costs O(N) copying in total.
+ * 
+ * @param sb A pointer to the string builder.
+ * @param need The number of bytes about to be appended.
+ * @param ms A pointer to the shell structure used for error reporting.
+ * 
+ * @return `1` on success, `0` if the buffer could not be grown.
+ */
+static int	sb_reserve(t_strbuf *sb, size_t need, t_ms *ms)
+{
+	char	*new;
+	size_t	cap;
+
+	if (sb->len + need < sb->cap)
+		return (1);
+	cap = sb->cap;
+	if (cap < STRBUF_SIZE)
+		cap = STRBUF_SIZE;
+	while (sb->len + need >= cap)
+		cap *= 2;
+	new = malloc(cap);
+	if (!new)
+	{
+		print_malloc_set_status(ms);
+		return (0);
+	}
+	if (sb->buf)
+		ft_memcpy(new, sb->buf, sb->len + 1);
+	free(sb->buf);
+	sb->buf = new;
+	sb->cap = cap;
+	return (1);
+}
+
+/**
+ * @brief Initializes a string builder holding an empty string.
+ * 
+ * @param sb A pointer to the string builder to initialize.
+ * @param hint The expected final length, used as the first capacity.
+ * @param ms A pointer to the shell structure used for error reporting.
+ * 
+ * @return `1` on success, `0` if the allocation failed.
+ */
+int	sb_init(t_strbuf *sb, size_t hint, t_ms *ms)
+{
+	sb->buf = NULL;
+	sb->len = 0;
+	sb->cap = 0;
+	if (!sb_reserve(sb, hint, ms))
+		return (0);
+	sb->buf[0] = '\0';
+	return (1);
+}
+
+/**
+ * @brief Appends `n` bytes of `s` to the string builder.
+ * 
+ * @param sb A pointer to the string builder.
+ * @param s The bytes to append.
+ * @param n The number of bytes to append.
+ * @param ms A pointer to the shell structure used for error reporting.
+ * 
+ * @return `1` on success, `0` if the buffer could not be grown.
+ */
+int	sb_append(t_strbuf *sb, const char *s, size_t n, t_ms *ms)
+{
+	if (!sb_reserve(sb, n, ms))
+		return (0);
+	ft_memcpy(sb->buf + sb->len, s, n);
+	sb->len += n;
+	sb->buf[sb->len] = '\0';
+	return (1);
+}
+
+/**
+ * @brief Appends a single character to the string builder.
+ * 
+ * @param sb A pointer to the string builder.
+ * @param c The character to append.
+ * @param ms A pointer to the shell structure used for error reporting.
+ * 
+ * @return `1` on success, `0` if the buffer could not be grown.
+ */
+int	sb_putc(t_strbuf *sb, char c, t_ms *ms)
+{
+	if (!sb_reserve(sb, 1, ms))
+		return (0);
+	sb->buf[sb->len++] = c;
+	sb->buf[sb->len] = '\0';
+	return (1);
+}
+
+/**
+ * @brief Releases the buffer of a string builder.
+ * 
+ * @param sb A pointer to the string builder.
+ */
+void	sb_free(t_strbuf *sb)
+{
+	free(sb->buf);
+	sb->buf = NULL;
+	sb->len = 0;
+	sb->cap = 0;
+}
@@ -6,7 +6,7 @@
 /*   By: ssalorin <ssalorin@student.hive.fi>        +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/03/27 14:10:50 by ssalorin          #+#    #+#             */
-/*   Updated: 2025/03/27 14:10:52 by ssalorin         ###   ########.fr       */
+/*   Updated: 2026/10/17 01:56:49 by agent            ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -16,13 +16,12 @@
  * @brief Validates a sequence of tokens within a command block.
  * 
  * This function checks whether all tokens between `start` and `end` are valid. 
- * A valid token is considered to be a WORD, a redirection, or a DUMMY token. 
- * If an invalid token is found, the error flag is set, and the function 
- * returns an error.
+ * A valid token is considered to be a WORD or a redirection. The tokens are 
+ * contiguous in the token vector, so this is a linear sweep. If an invalid 
+ * token is found, the error flag is set, and the function returns an error.
  * 
  * @param start A pointer to the first token in the block.
- * @param end A pointer to the token marking the end of the block (not included 
- *            in validation).
+ * @param end A pointer just past the last token of the block.
  * @param err_flag A pointer to an integer flag used to indicate errors. If an 
  *                 invalid token is encountered, the flag is set to `1`.
  * 
@@ -38,13 +37,12 @@ int	check_block(t_token *start, t_token *end, int *err_flag)
 	cur = start;
 	while (cur != end)
 	{
-		if (!(cur->type == WORD || is_redirect(cur->type)
-				|| cur->type == DUMMY))
+		if (!(cur->type == WORD || is_redirect(cur->type)))
 		{
 			*err_flag = 1;
 			return (1);
 		}
-		cur = cur->next;
+		cur++;
 	}
 	return (0);
 }
@@ -52,8 +50,8 @@ int	check_block(t_token *start, t_token *end, int *err_flag)
 /**
  * @brief Creates and appends a new block to the list of command blocks.
  * 
- * This function allocates memory for a new `t_block` structure, 
- * initializing its `start` and `end` pointers with the given tokens. 
+ * This function allocates a new `t_block` structure from the line arena, 
+ * initializing its `start` and `end` indexes into `ms->tokens`. 
  * If memory allocation fails, it sets the `ms->err` flag to `1`, 
  * prints an error message, and returns the original `first_block` list.
  * 
@@ -62,26 +60,26 @@ int	check_block(t_token *start, t_token *end, int *err_flag)
  * the end of the existing linked list.
  * 
  * @param ms Pointer to the main shell structure containing error status.
- * @param start Pointer to the first token of the new block.
- * @param end Pointer to the last token (not included) of the new block.
+ * @param start Index of the first token of the new block.
+ * @param end Index just past the last token of the new block.
  * @param first_block Pointer to the first block in the linked list.
  * 
  * @return Pointer to the head of the block list, either the same as 
  *         `first_block` or a newly created block if the list was empty.
  */
-t_block	*create_block(t_ms *ms, t_token *start, t_token *end, \
+t_block	*create_block(t_ms *ms, size_t start, size_t end, \
 		t_block *first_block)
 {
 	t_block	*new;
 	t_block	*cur;
 
-	if (check_block(start, end, &(ms->err)))
+	if (check_block(ms->tokens.arr + start, ms->tokens.arr + end,
+			&(ms->err)))
 		return (first_block);
-	new = (t_block *)malloc(1 * sizeof(t_block));
+	new = (t_block *)arena_alloc(ms, sizeof(t_block));
 	if (!new)
 	{
 		ms->err = 1;
-		print_malloc_set_status(ms);
 		return (first_block);
 	}
 	new->start = start;
@@ -99,9 +97,9 @@ t_block	*create_block(t_ms *ms, t_token *start, t_token *end, \
 /**
  * @brief Splits tokens into command blocks based on pipe (`|`) tokens.
  * 
- * This function iterates through a list of tokens, dividing them into 
+ * This function iterates through the token vector, dividing it into 
  * separate command blocks whenever a `PIPE` token is encountered. 
- * Each created block represents a segment of the command sequence.
+ * Each created block is an index range over the vector.
  * 
  * - If a `PIPE` token is found, a new block is created from `start` to 
  *   the current token, and `start` is updated to the next token.
@@ -111,31 +109,32 @@ t_block	*create_block(t_ms *ms, t_token *start, t_token *end, \
  *   the head of the linked list of blocks.
  * 
  * @param ms Pointer to the main shell structure containing error status.
- * @param start Pointer to the first token in the sequence.
- * @param end Pointer to the last token (not included) in the sequence.
+ * @param toks Pointer to the token vector of the current line.
  * 
  * @return Pointer to the head of the list of created blocks, or `NULL` 
  *         if an error occurs.
  */
-t_block	*create_blocks_list(t_ms *ms, t_token *start, t_token *end)
+t_block	*create_blocks_list(t_ms *ms, t_tokens *toks)
 {
-	t_token	*cur_token;
 	t_block	*first_block;
+	size_t	start;
+	size_t	i;
 
 	first_block = NULL;
-	cur_token = start;
-	while (cur_token->next && cur_token != end)
+	start = 0;
+	i = 0;
+	while (i < toks->len)
 	{
-		if (cur_token->type == PIPE)
+		if (toks->arr[i].type == PIPE)
 		{
-			first_block = create_block(ms, start, cur_token, first_block);
-			start = cur_token->next;
+			first_block = create_block(ms, start, i, first_block);
+			start = i + 1;
 		}
-		cur_token = cur_token->next;
+		i++;
 		if (ms->err)
 			return (clean_block_list(&first_block));
 	}
-	first_block = create_block(ms, start, cur_token->next, first_block);
+	first_block = create_block(ms, start, toks->len, first_block);
 	return (first_block);
 }
 
@@ -147,8 +146,7 @@ t_block	*create_blocks_list(t_ms *ms, t_token *start, t_token *end)
  * number of arguments present in a command block.
  * 
  * @param start A pointer to the first token in the block.
- * @param end A pointer to the token marking the end of the block (not included 
- *            in counting).
+ * @param end A pointer just past the last token of the block.
  * 
  * @return The number of WORD tokens found in the given range.
  * 
@@ -169,7 +167,7 @@ int	words_in_cmd_block(t_token *start, t_token *end)
 			if (cur->expanded == true && has_multiple_words(cur->data))
 				res++;
 		}
-		cur = cur->next;
+		cur++;
 	}
 	return (res);
 }
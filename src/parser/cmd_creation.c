@@ -6,7 +6,7 @@
 /*   By: ssalorin <ssalorin@student.hive.fi>        +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/03/27 14:11:05 by ssalorin          #+#    #+#             */
-/*   Updated: 2025/03/27 14:11:07 by ssalorin         ###   ########.fr       */
+/*   Updated: 2026/10/17 01:56:49 by agent            ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -33,21 +33,21 @@ static void	default_cmd_values(t_cmd *new, int num)
 	new->num = num;
 	new->infile = DEF;
 	new->outfile = DEF;
+	new->heredoc = false;
 	new->next = NULL;
 }
 
 /**
  * @brief Fills the command arguments array with WORD tokens.
  * 
- * Iterates through tokens from `start` to `end`, copying the 
- * data of tokens of type `WORD` into the `args` array of the given 
+ * Sweeps the tokens from `start` to `end`, storing the 
+ * data of tokens of type `WORD` in the `args` array of the given 
  * `cmd` structure. If a token was expanded into multiple words, it is 
  * split and stored as separate arguments.
  * 
  * @param cmd A pointer to the command structure where arguments will be stored.
  * @param start A pointer to the first token in the block.
- * @param end A pointer to the token marking the end of the block 
- *            (not included in processing).
+ * @param end A pointer just past the last token of the block.
  * @param ms Pointer to the shell structure for error handling.
  * 
  * @return `0` on success, `1` if memory allocation fails.
@@ -65,17 +65,14 @@ int	put_cmg_args(t_cmd *cmd, t_token *start, t_token *end, t_ms *ms)
 		{
 			if (cur->expanded == false || (cur->expanded == true && \
 				!has_multiple_words(cur->data)))
-			{
-				if (copy_single_word(cmd, cur->data, &i, ms))
-					return (1);
-			}
+				copy_single_word(cmd, cur->data, &i);
 			else
 			{
 				if (copy_expanded_words(cmd, cur->data, &i, ms))
 					return (1);
 			}
 		}
-		cur = cur->next;
+		cur++;
 	}
 	cmd->args[i] = NULL;
 	return (0);
@@ -109,14 +106,16 @@ int	put_cmg_args(t_cmd *cmd, t_token *start, t_token *end, t_ms *ms)
 void	redir_in_block(t_block *block, t_cmd *cmd, t_ms *ms)
 {
 	t_token	*cur;
+	t_token	*end;
 
-	cur = block->start;
-	while (cur != block->end)
+	cur = ms->tokens.arr + block->start;
+	end = ms->tokens.arr + block->end;
+	while (cur != end)
 	{
 		if (is_redirect(cur->type) && g_sgnl != SIGINT)
 		{
 			if (cur->type == IN)
-				put_infile_fd(cur, cmd);
+				put_infile_fd(cur, cmd, ms);
 			else if (cur->type == OUT || cur->type == APPEND)
 				put_outfile_fd(cur, cmd);
 			else if (cur->type == HEREDOC)
@@ -127,20 +126,20 @@ void	redir_in_block(t_block *block, t_cmd *cmd, t_ms *ms)
 				return ;
 			}
 		}
-		cur = cur->next;
+		cur++;
 	}
 }
 
 /**
  * @brief Creates a new command structure from a given block of tokens.
  * 
- * This function allocates and initializes a new `t_cmd` structure, extracts 
- * arguments from the tokens within the specified block, and processes any 
- * redirection operators (input, output, or heredoc). The arguments and 
+ * This function allocates (from the line arena) and initializes a new 
+ * `t_cmd` structure, extracts arguments from the tokens within the 
+ * specified block, and processes any redirection operators (input, output, or heredoc). The arguments and 
  * redirection file descriptors are stored in the `t_cmd` structure, which 
  * is then returned. The `default_cmd_values` function is called to set 
- * initial values for the new command, and memory is cleaned up if allocation 
- * fails at any step.
+ * initial values for the new command. If an allocation fails, NULL is 
+ * returned and the partial command is reclaimed with the arena.
  * 
  * @param block A pointer to the block containing tokens representing the 
  *              command.
@@ -161,21 +160,20 @@ void	redir_in_block(t_block *block, t_cmd *cmd, t_ms *ms)
 t_cmd	*create_new_cmd(t_block *block, int num, t_ms *ms)
 {
 	t_cmd	*new;
+	t_token	*start;
 	int		words;
 
-	new = (t_cmd *)malloc(1 * sizeof(t_cmd));
+	new = (t_cmd *)arena_alloc(ms, sizeof(t_cmd));
 	if (!new)
-		return (print_malloc_set_status(ms));
+		return (NULL);
 	default_cmd_values(new, num);
-	words = words_in_cmd_block(block->start, block->end);
-	new->args = (char **)malloc((words + 1) * sizeof(char *));
+	start = ms->tokens.arr + block->start;
+	words = words_in_cmd_block(start, ms->tokens.arr + block->end);
+	new->args = (char **)arena_alloc(ms, (words + 1) * sizeof(char *));
 	if (!new->args)
-	{
-		print_malloc_set_status(ms);
-		return (clean_cmd(new));
-	}
-	if (put_cmg_args(new, block->start, block->end, ms))
-		return (clean_cmd(new));
+		return (NULL);
+	if (put_cmg_args(new, start, ms->tokens.arr + block->end, ms))
+		return (NULL);
 	new->name = new->args[0];
 	redir_in_block(block, new, ms);
 	return (new);
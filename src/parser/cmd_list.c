@@ -0,0 +1,165 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   cmd_list.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: agent <agent@local>                        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 02:24:25 by agent             #+#    #+#             */
+/*   Updated: 2026/10/17 02:31:20 by agent            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../include/minishell.h"
+
+/**
+ * @brief Allocates a node of the command list from the line arena.
+ * 
+ * @param ms A pointer to the main shell structure.
+ * @param op The operator of the node.
+ * @param start The index of the node's first token.
+ * 
+ * @return The new node, or NULL if the allocation fails.
+ */
+static t_node	*new_node(t_ms *ms, t_type op, size_t start)
+{
+	t_node	*node;
+
+	node = (t_node *)arena_alloc(ms, sizeof(t_node));
+	if (!node)
+		return (NULL);
+	node->op = op;
+	node->start = start;
+	node->end = start;
+	node->timed = 0;
+	node->body = NULL;
+	node->next = NULL;
+	return (node);
+}
+
+/**
+ * @brief Parses one pipeline, up to the next list operator.
+ * 
+ * A leading `time` reserved word is taken off the pipeline and noted in 
+ * the node.
+ * 
+ * @param ms A pointer to the main shell structure.
+ * @param toks A pointer to the raw tokens of the line.
+ * @param i A pointer to the index of the pipeline's first token; it is 
+ *          left on the list operator that ends the pipeline.
+ * @param op The operator before the pipeline: `EMPTY`, `AND_IF` or `OR_IF`.
+ * 
+ * @return The pipeline node, or NULL if an allocation fails.
+ */
+static t_node	*parse_pipeline(t_ms *ms, t_tokens *toks, size_t *i,
+		t_type op)
+{
+	t_node	*node;
+
+	node = new_node(ms, op, *i);
+	if (!node)
+		return (NULL);
+	*i = parse_time(toks, *i, &node->timed);
+	node->start = *i;
+	while (*i < toks->len && toks->arr[*i].type != SEMI
+		&& toks->arr[*i].type != BACKGROUND && toks->arr[*i].type != AND_IF
+		&& toks->arr[*i].type != OR_IF)
+		(*i)++;
+	node->end = *i;
+	return (node);
+}
+
+/**
+ * @brief Parses an and-or list: pipelines joined by `&&` and `||`.
+ * 
+ * The two operators have the same precedence and group to the left, so 
+ * the list is kept flat, each pipeline remembering the operator before 
+ * it. The node's `end` is the index of the `;` or `&` that ends the list, 
+ * or the number of tokens, and its `op` tells which one it was.
+ * 
+ * @param ms A pointer to the main shell structure.
+ * @param toks A pointer to the raw tokens of the line.
+ * @param i A pointer to the index of the list's first token; it is left 
+ *          past the operator that ends the list.
+ * 
+ * @return The and-or node, or NULL if an allocation fails.
+ */
+static t_node	*parse_and_or(t_ms *ms, t_tokens *toks, size_t *i)
+{
+	t_node	*item;
+	t_node	**tail;
+	t_type	op;
+
+	item = new_node(ms, SEMI, *i);
+	if (!item)
+		return (NULL);
+	tail = &item->body;
+	op = EMPTY;
+	while (op == EMPTY || op == AND_IF || op == OR_IF)
+	{
+		*tail = parse_pipeline(ms, toks, i, op);
+		if (!*tail)
+			return (NULL);
+		tail = &(*tail)->next;
+		item->end = *i;
+		op = SEMI;
+		if (*i < toks->len)
+			op = toks->arr[(*i)++].type;
+	}
+	item->op = op;
+	return (item);
+}
+
+/**
+ * @brief Builds the command list of a line from its raw tokens.
+ * 
+ * The line is parsed once into a two-level tree allocated from the line 
+ * arena: a list of and-or lists, separated by `;` or `&`, each holding its 
+ * pipelines as token ranges. The lexer has already checked the syntax, so 
+ * every range is a complete pipeline. A line without tokens gives one 
+ * empty pipeline, which runs like an empty line did before.
+ * 
+ * @param ms A pointer to the main shell structure.
+ * @param toks A pointer to the raw tokens of the line.
+ * 
+ * @return The first and-or list, or NULL if an allocation fails.
+ */
+t_node	*parse_list(t_ms *ms, t_tokens *toks)
+{
+	t_node	*first;
+	t_node	**tail;
+	size_t	i;
+
+	first = NULL;
+	tail = &first;
+	i = 0;
+	while (!first || i < toks->len)
+	{
+		*tail = parse_and_or(ms, toks, &i);
+		if (!*tail)
+			return (NULL);
+		tail = &(*tail)->next;
+	}
+	return (first);
+}
+
+/**
+ * @brief Copies the source text of a background and-or list.
+ * 
+ * The text runs from the list's first token up to and including its `&`, 
+ * and becomes the job's command text for `jobs`.
+ * 
+ * @param ms A pointer to the main shell structure.
+ * @param item The and-or list, ended by `&`.
+ * 
+ * @return The text, or NULL if the allocation fails.
+ */
+char	*list_text(t_ms *ms, t_node *item)
+{
+	size_t	from;
+	size_t	to;
+
+	from = ms->line.toks.arr[item->start].pos;
+	to = ms->line.toks.arr[item->end].pos + 1;
+	return (ft_substr(ms->line.text, from, to - from));
+}
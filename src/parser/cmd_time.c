@@ -0,0 +1,63 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   cmd_time.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: agent <agent@local>                        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 02:31:20 by agent             #+#    #+#             */
+/*   Updated: 2026/10/17 03:16:31 by agent            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../include/minishell.h"
+
+/**
+ * @brief Tells whether a raw token is exactly the given unquoted word.
+ * 
+ * @param tok The raw token.
+ * @param word The word to compare with.
+ * 
+ * @return 1 if it is, 0 otherwise.
+ */
+static int	is_bare_word(t_token *tok, char *word)
+{
+	size_t	len;
+
+	len = ft_strlen(word);
+	return (tok->type == WORD && tok->segs && !tok->segs->next
+		&& !tok->segs->quote && tok->segs->len == len
+		&& ft_strncmp(tok->segs->start, word, len) == 0);
+}
+
+/**
+ * @brief Recognizes the `time` reserved word at the start of a pipeline.
+ * 
+ * Like in bash, `time` is only a reserved word as the first word of a 
+ * pipeline and when unquoted, so `"time"` or `echo time` run as usual. 
+ * `time -p` selects the POSIX output format. A repeated `time`, as in 
+ * `time time cmd`, is a reserved word again and the pipeline is timed once.
+ * 
+ * @param toks A pointer to the raw tokens of the line.
+ * @param i The index of the pipeline's first token.
+ * @param timed Set to 0, `TIMED` or `TIMED_POSIX`.
+ * 
+ * @return The index of the first token after the reserved word and its 
+ *         option.
+ */
+size_t	parse_time(t_tokens *toks, size_t i, int *timed)
+{
+	*timed = 0;
+	while (i < toks->len && is_bare_word(&toks->arr[i], "time"))
+	{
+		if (!*timed)
+			*timed = TIMED;
+		i++;
+		if (i < toks->len && is_bare_word(&toks->arr[i], "-p"))
+		{
+			*timed = TIMED_POSIX;
+			i++;
+		}
+	}
+	return (i);
+}
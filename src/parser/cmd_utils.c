@@ -6,7 +6,7 @@
 /*   By: ssalorin <ssalorin@student.hive.fi>        +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/03/31 17:01:35 by ssalorin          #+#    #+#             */
-/*   Updated: 2025/03/31 17:01:37 by ssalorin         ###   ########.fr       */
+/*   Updated: 2026/10/17 01:56:49 by agent            ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -17,50 +17,46 @@
  * string.
  * 
  * This function scans the input string `str` until it encounters 
- * a space or reaches the end of the string. It then allocates memory 
- * for a new string, copies the characters before the first space 
- * into it, and null-terminates it.
+ * a space or reaches the end of the string. It then copies the 
+ * characters before the first space into a new string allocated in the 
+ * line arena.
  * 
  * @param str The input string from which the substring is extracted.
+ * @param ms Pointer to the shell structure owning the arena.
  * 
- * @return A newly allocated string containing the characters before 
+ * @return A new string containing the characters before 
  *         the first space, or `NULL` if memory allocation fails or 
  *         if `str` is `NULL`.
  */
-char	*str_before_space(const char *str)
+char	*str_before_space(const char *str, t_ms *ms)
 {
 	int		len;
-	char	*before;
 
 	if (!str)
 		return (NULL);
 	len = 0;
 	while (str[len] && str[len] != ' ')
 		len++;
-	before = (char *)malloc(len + 1);
-	if (!before)
-		return (NULL);
-	ft_strncpy(before, str, len);
-	before[len] = '\0';
-	return (before);
+	return (arena_strndup(ms, str, len));
 }
 
 /**
- * @brief Returns a newly allocated string containing the part after 
- * the first space.
+ * @brief Returns a new string containing the part after the first 
+ * space.
  * 
  * This function searches for the first occurrence of a space in the 
- * given string `str`. If found, it returns a duplicate of the 
+ * given string `str`. If found, it returns an arena copy of the 
  * substring that comes after the space. If there is no space or the 
  * space is at the end of the string, the function returns `NULL`.
  * 
  * @param str The input string to process.
+ * @param ms Pointer to the shell structure owning the arena.
  * 
- * @return A newly allocated string containing the substring after 
+ * @return A new string containing the substring after 
  *         the first space, or `NULL` if there is no valid substring 
  *         or memory allocation fails.
  */
-char	*str_after_space(const char *str)
+char	*str_after_space(const char *str, t_ms *ms)
 {
 	char	*space_ptr;
 
@@ -69,7 +65,7 @@ char	*str_after_space(const char *str)
 	space_ptr = ft_strchr(str, ' ');
 	if (!space_ptr || *(space_ptr + 1) == '\0')
 		return (NULL);
-	return (ft_strdup(space_ptr + 1));
+	return (arena_strdup(ms, space_ptr + 1));
 }
 
 /**
@@ -108,25 +104,19 @@ int	has_multiple_words(const char *str)
 }
 
 /**
- * @brief Copies a single word to the command's argument array.
+ * @brief Stores a single word in the command's argument array.
+ * 
+ * The word's text already lives in the line arena, which outlives the 
+ * command, so the argument points at it instead of copying it.
  * 
  * @param cmd Pointer to the command structure where the argument is stored.
- * @param data The string to be copied.
+ * @param data The word's text.
  * @param index Pointer to the current index in the `args` array.
- * @param ms Pointer to the shell structure for error handling.
- * 
- * @return `1` on allocation failure, `0` on success.
  */
-int	copy_single_word(t_cmd *cmd, const char *data, int *index, t_ms *ms)
+void	copy_single_word(t_cmd *cmd, char *data, int *index)
 {
-	cmd->args[*index] = ft_strdup(data);
-	if (!cmd->args[*index])
-	{
-		print_malloc_set_status(ms);
-		return (1);
-	}
+	cmd->args[*index] = data;
 	(*index)++;
-	return (0);
 }
 
 /**
@@ -142,13 +132,12 @@ int	copy_single_word(t_cmd *cmd, const char *data, int *index, t_ms *ms)
  */
 int	copy_expanded_words(t_cmd *cmd, const char *data, int *index, t_ms *ms)
 {
-	cmd->args[*index] = str_before_space(data);
-	cmd->args[*index + 1] = str_after_space(data);
-	if (!cmd->args[*index] || !cmd->args[*index + 1])
-	{
-		print_malloc_set_status(ms);
+	cmd->args[*index] = str_before_space(data, ms);
+	if (!cmd->args[*index])
+		return (1);
+	cmd->args[*index + 1] = str_after_space(data, ms);
+	if (!cmd->args[*index + 1])
 		return (1);
-	}
 	*index += 2;
 	return (0);
 }
@@ -6,114 +6,106 @@
 /*   By: ssalorin <ssalorin@student.hive.fi>        +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/03/27 14:20:26 by ssalorin          #+#    #+#             */
-/*   Updated: 2025/03/27 14:20:29 by ssalorin         ###   ########.fr       */
+/*   Updated: 2026/10/17 01:42:37 by agent            ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "../../include/minishell.h"
 
 /**
- * @brief Initializes the history array by setting all its lines to NULL.
+ * @brief Initializes an empty history.
  * 
- * This function ensures that all elements in the history array are 
- * initialized to NULL, preventing potential undefined behavior.
+ * Nothing is allocated until the first line is stored, and the limit starts 
+ * at `HISTORY_SIZE` until `HISTSIZE` says otherwise.
  * 
- * @param history A pointer to the history array.
+ * @param h A pointer to the history.
  */
-void	default_history(char **history)
+void	default_history(t_history *h)
 {
-	int	i;
-
-	i = 0;
-	while (i < HISTORY_SIZE)
-	{
-		history[i] = NULL;
-		i++;
-	}
+	ft_memset(h, 0, sizeof(t_history));
+	h->max = HISTORY_SIZE;
 }
 
 /**
  * @brief Stores a command line into the ms history field.
  * 
- * This function saves the given command line into the history array 
- * within the `t_ms` structure. If the current history slot is occupied, 
- * it frees the memory before storing the new line. The function ensures 
- * a circular buffer behavior by resetting the index when it reaches the 
- * limit.
+ * This function saves a copy of the given command line at the end of the 
+ * history ring in the `t_ms` structure. Once the ring holds more than 
+ * `HISTSIZE` lines, the oldest ones are dropped.
  * 
  * @param line The command line to be stored in history.
- * @param ms A pointer to the shell structure containing the history array.
+ * @param ms A pointer to the shell structure containing the history.
  */
 void	fill_ms_history_line(char *line, t_ms *ms)
 {
-	if (ms->history[ms->history_num])
-		free(ms->history[ms->history_num]);
-	ms->history[ms->history_num] = ft_strdup(line);
-	if (!ms->history[ms->history_num])
-	{
+	if (!history_push(&ms->hist, line))
 		print_malloc_set_status(ms);
-		return ;
-	}
-	if (ms->history_num == HISTORY_SIZE - 1)
-		ms->history_num = 0;
-	else
-		ms->history_num++;
 }
 
 /**
  * @brief Adds a command line to the shell's history.
  * 
- * This function checks if the given line is not empty and, if so, 
- * adds it to both the readline history and the ms field history array.
+ * This function checks if the given line is not empty and, if `HISTCONTROL` 
+ * and `HISTSIZE` allow it, adds it to both the readline history and the ms 
+ * field history, and appends it to the history file straight away.
  * 
  * @param line The command line to be added to history.
  * @param ms A pointer to the shell structure containing the history.
  */
 void	add_line_to_history(char *line, t_ms *ms)
 {
-	if (line[0] != '\0')
-	{
-		add_history(line);
-		if (ms->history_file == true)
-			fill_ms_history_line(line, ms);
-	}
+	int	flags;
+
+	if (line[0] == '\0')
+		return ;
+	flags = history_settings(ms);
+	if (history_skip_line(line, flags, &ms->hist))
+		return ;
+	add_history(line);
+	fill_ms_history_line(line, ms);
+	if (ms->history_file == true)
+		append_to_history_file(line, ms);
 }
 
 /**
- * @brief Frees the allocated memory for the ms field history array.
+ * @brief Frees the allocated memory for the ms field history.
  * 
- * This function iterates through the history array in the `t_ms` structure 
- * and frees each allocated string, setting the corresponding pointers to NULL.
+ * This function frees every entry in the history ring, the ring itself and 
+ * the duplicate index, leaving an empty history. The history file 
+ * descriptor and path are released as well.
  * 
  * @param ms A pointer to the shell structure containing the history.
  */
 void	clean_ms_history(t_ms *ms)
 {
-	int	i;
+	t_history	*h;
 
-	i = 0;
-	while (i < HISTORY_SIZE)
+	h = &ms->hist;
+	while (h->first < h->end)
 	{
-		if (ms->history[i])
-		{
-			free(ms->history[i]);
-			ms->history[i] = NULL;
-		}
-		i++;
+		free(h->ring[h->first & (h->cap - 1)]);
+		h->first++;
 	}
+	free(h->ring);
+	free(h->buckets);
+	default_history(h);
+	if (ms->history_fd >= 0)
+		close(ms->history_fd);
+	ms->history_fd = -1;
+	free(ms->history_path);
+	ms->history_path = NULL;
 }
 
 /**
  * @brief Handles the exit process for the shell's history.
  * 
- * This function ensures that the command history is properly saved 
- * before the shell exits. It writes the current history to a file 
- * and then clears the in-memory history to free resources.
+ * Every line was already appended to the history file when it was accepted, 
+ * so nothing is written here; the in-memory history is cleared and the file 
+ * is closed.
  * 
  * @param ms A pointer to the shell structure containing the history.
  */
 void	history_exit(t_ms *ms)
 {
-	write_to_history_file(ms);
 	clean_ms_history(ms);
 }
@@ -0,0 +1,125 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   history_append.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: agent <agent@local>                        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 01:33:53 by agent             #+#    #+#             */
+/*   Updated: 2026/10/17 03:14:35 by agent            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../include/minishell.h"
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/uio.h>
+
+/**
+ * @brief Counts the lines of a part of the history file.
+ * 
+ * @param s The start of the part.
+ * @param n Its length in bytes.
+ * 
+ * @return The number of newlines in the part.
+ */
+static size_t	count_lines(const char *s, size_t n)
+{
+	size_t	lines;
+
+	lines = 0;
+	while (n-- > 0)
+	{
+		if (*s++ == '\n')
+			lines++;
+	}
+	return (lines);
+}
+
+/**
+ * @brief Moves the newest lines of the locked history file to its start.
+ * 
+ * The file is mapped shared, so it is read as it is now, lines of other 
+ * shells included, and the lines that fit in the history are moved down in 
+ * place. The file is then cut with `ftruncate`; it is never replaced, so 
+ * descriptors other shells keep open on it stay valid.
+ * 
+ * @param ms Pointer to the shell structure holding the history file.
+ */
+static void	compact_locked(t_ms *ms)
+{
+	struct stat	st;
+	char		*map;
+	size_t		start;
+	size_t		keep;
+
+	if (fstat(ms->history_fd, &st) < 0 || st.st_size == 0)
+		return ;
+	map = mmap(NULL, st.st_size, PROT_READ | PROT_WRITE, MAP_SHARED,
+			ms->history_fd, 0);
+	if (map == MAP_FAILED)
+		return ;
+	start = history_tail(map, st.st_size, ms->hist.max);
+	keep = st.st_size - start;
+	if (start > 0)
+		ft_memmove(map, map + start, keep);
+	ms->history_lines = count_lines(map, keep);
+	munmap(map, st.st_size);
+	if (start > 0)
+		ftruncate(ms->history_fd, keep);
+}
+
+/**
+ * @brief Cuts the history file down to the lines the history keeps.
+ * 
+ * Several shells may share the file, so it is compacted under an exclusive 
+ * `flock`, while appending lines takes a shared one. No line another shell 
+ * appends can therefore slip in between reading the file and cutting it.
+ * On failure the shell simply keeps appending to the longer file.
+ * 
+ * @param ms Pointer to the shell structure containing the command history.
+ */
+void	compact_history_file(t_ms *ms)
+{
+	if (flock(ms->history_fd, LOCK_EX) < 0)
+		return ;
+	compact_locked(ms);
+	flock(ms->history_fd, LOCK_UN);
+}
+
+/**
+ * @brief Appends one accepted line to the history file.
+ * 
+ * The line and its newline go out in a single `writev`, so the history is on 
+ * disk as soon as the line is accepted and lines from several shells never 
+ * interleave. Once the file holds at least `HISTORY_COMPACT` lines and twice 
+ * as many as the ring, it is compacted to the newest lines that fit in the 
+ * ring, which keeps both the file and start-up time bounded while costing 
+ * amortized constant time per line even for very large `HISTSIZE` values.
+ * 
+ * @param line The command line to be stored.
+ * @param ms Pointer to the shell structure containing the command history.
+ */
+void	append_to_history_file(char *line, t_ms *ms)
+{
+	struct iovec	iov[2];
+
+	if (ms->history_fd < 0)
+		return ;
+	iov[0].iov_base = line;
+	iov[0].iov_len = ft_strlen(line);
+	iov[1].iov_base = "\n";
+	iov[1].iov_len = 1;
+	if (flock(ms->history_fd, LOCK_SH) < 0)
+		return ;
+	if (writev(ms->history_fd, iov, 2) < 0)
+	{
+		flock(ms->history_fd, LOCK_UN);
+		return ;
+	}
+	flock(ms->history_fd, LOCK_UN);
+	ms->history_lines++;
+	if (ms->history_lines >= HISTORY_COMPACT
+		&& ms->history_lines >= 2 * ms->hist.live)
+		compact_history_file(ms);
+}
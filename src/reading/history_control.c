@@ -0,0 +1,173 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   history_control.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: agent <agent@local>                        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 01:42:37 by agent             #+#    #+#             */
+/*   Updated: 2026/10/17 03:15:06 by agent            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../include/minishell.h"
+
+/**
+ * @brief Parses the value of `HISTSIZE`.
+ * 
+ * Like in bash, a negative number means no limit. An unset, empty or 
+ * non-numeric value falls back to `HISTORY_SIZE`.
+ * 
+ * @param value The value of `HISTSIZE`, or NULL if it is not set.
+ * 
+ * @return The maximum number of history entries.
+ */
+static size_t	parse_histsize(char *value)
+{
+	int	i;
+	int	neg;
+
+	if (!value || !*value)
+		return (HISTORY_SIZE);
+	neg = (value[0] == '-');
+	i = neg;
+	while (ft_isdigit(value[i]))
+		i++;
+	if (value[i] || i == neg || i - neg > 9)
+		return (HISTORY_SIZE);
+	if (neg)
+		return (HIST_UNLIMITED);
+	return ((size_t)ft_atoi(value));
+}
+
+/**
+ * @brief Parses the colon-separated value of `HISTCONTROL`.
+ * 
+ * Recognizes `ignorespace`, `ignoredups`, `ignoreboth` and `erasedups`; 
+ * anything else is ignored, as in bash.
+ * 
+ * @param value The value of `HISTCONTROL`, or NULL if it is not set.
+ * 
+ * @return A mask of `HIST_IGNORESPACE`, `HIST_IGNOREDUPS` and 
+ *         `HIST_ERASEDUPS`.
+ */
+static int	parse_histcontrol(char *value)
+{
+	int		flags;
+	size_t	len;
+
+	flags = 0;
+	while (value && *value)
+	{
+		len = 0;
+		while (value[len] && value[len] != ':')
+			len++;
+		if (len == 11 && !ft_strncmp(value, "ignorespace", len))
+			flags |= HIST_IGNORESPACE;
+		else if (len == 10 && !ft_strncmp(value, "ignoredups", len))
+			flags |= HIST_IGNOREDUPS;
+		else if (len == 10 && !ft_strncmp(value, "ignoreboth", len))
+			flags |= HIST_IGNORESPACE | HIST_IGNOREDUPS;
+		else if (len == 9 && !ft_strncmp(value, "erasedups", len))
+			flags |= HIST_ERASEDUPS;
+		value += len;
+		if (*value == ':')
+			value++;
+	}
+	return (flags);
+}
+
+/**
+ * @brief Applies the current `HISTSIZE` and reads `HISTCONTROL`.
+ * 
+ * Both are looked up for every accepted line, so changing them takes effect 
+ * immediately. When the size shrinks, the oldest entries are dropped; the 
+ * readline history is limited to the same size.
+ * 
+ * @param ms A pointer to the main shell structure.
+ * 
+ * @return The `HISTCONTROL` flags.
+ */
+int	history_settings(t_ms *ms)
+{
+	size_t	max;
+
+	max = parse_histsize(get_env_value("HISTSIZE", ms));
+	if (max != ms->hist.max)
+	{
+		ms->hist.max = max;
+		history_trim(&ms->hist);
+		if (max == HIST_UNLIMITED)
+			unstifle_history();
+		else
+			stifle_history((int)max);
+	}
+	return (parse_histcontrol(get_env_value("HISTCONTROL", ms)));
+}
+
+/**
+ * @brief Removes every copy of a line from the readline history.
+ * 
+ * `history_search_pos` finds the candidates, from the newest backwards; it 
+ * matches substrings, so each one is compared before it is removed. Going 
+ * backwards, removing an entry does not move the ones still to be checked.
+ * 
+ * @param line The line whose copies are removed.
+ */
+static void	erase_readline_dups(const char *line)
+{
+	HIST_ENTRY	*ent;
+	int			pos;
+
+	pos = history_search_pos(line, -1, history_length - 1);
+	while (pos >= 0)
+	{
+		ent = history_get(history_base + pos);
+		if (ent && !ft_strcmp(ent->line, line))
+			free_history_entry(remove_history(pos));
+		if (pos == 0)
+			break ;
+		pos = history_search_pos(line, -1, pos - 1);
+	}
+}
+
+/**
+ * @brief Decides whether a line is kept out of the history.
+ * 
+ * With `erasedups`, every earlier copy of the line is removed instead, each 
+ * found through the duplicate index in constant time. The readline history 
+ * is only searched when the index found a copy, so both stay in sync.
+ * 
+ * @param line The accepted command line.
+ * @param flags The `HISTCONTROL` flags.
+ * @param h A pointer to the history.
+ * 
+ * @return `1` if the line must not be saved, `0` otherwise.
+ */
+int	history_skip_line(char *line, int flags, t_history *h)
+{
+	t_hent	*last;
+	t_hent	*dup;
+
+	if (h->max == 0)
+		return (1);
+	if ((flags & HIST_IGNORESPACE) && line[0] == ' ')
+		return (1);
+	last = NULL;
+	if (h->end > h->first)
+		last = h->ring[(h->end - 1) & (h->cap - 1)];
+	if ((flags & HIST_IGNOREDUPS) && last && !ft_strcmp(last->line, line))
+		return (1);
+	if (flags & HIST_ERASEDUPS)
+	{
+		dup = history_find(h, line);
+		if (dup)
+			erase_readline_dups(line);
+		while (dup)
+		{
+			history_erase(h, dup);
+			dup = history_find(h, line);
+		}
+	}
+	return (0);
+}
@@ -6,108 +6,144 @@
 /*   By: ssalorin <ssalorin@student.hive.fi>        +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/03/27 14:20:18 by ssalorin          #+#    #+#             */
-/*   Updated: 2025/03/27 14:20:20 by ssalorin         ###   ########.fr       */
+/*   Updated: 2026/10/17 03:14:35 by agent            ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
+
 #include "../../include/minishell.h"
+#include <sys/mman.h>
 
 /**
- * @brief Reads command history from a file and stores it in ms structure.
+ * @brief Finds where the last `max` lines of the history file start.
  * 
- * This function reads up to `HISTORY_SIZE` lines from the given file descriptor 
- * `fd` and stores them in the `ms->history` array. Each line is also added to 
- * the readline history using `add_history()`.
+ * Only those lines fit in the history ring, so the file is scanned backwards 
+ * from its end and everything before them is never touched. Loading therefore 
+ * costs the same however long the file has grown. Compaction keeps the 
+ * same lines.
  * 
- * @param fd File descriptor of the history file.
- * @param ms Pointer to the shell structure where the history is stored.
+ * @param map The mapped history file.
+ * @param size The size of the file in bytes.
+ * @param max The number of lines the history ring keeps.
  * 
- * @note If memory allocation fails, the function stops reading further lines.
+ * @return The offset of the first line to keep.
  */
-static void	read_from_history_file(int fd, t_ms *ms)
+size_t	history_tail(const char *map, size_t size, size_t max)
 {
-	char	*buf;
-	char	*trimmed;
+	size_t	i;
+	size_t	lines;
 
-	while (1)
+	i = size;
+	if (i > 0 && map[i - 1] == '\n')
+		i--;
+	lines = 0;
+	while (i > 0)
 	{
-		buf = get_next_line(fd);
-		if (!buf)
-			return ;
-		trimmed = ft_strtrim(buf, "\n");
-		if (!trimmed)
+		if (map[i - 1] == '\n')
 		{
-			free(buf);
-			print_malloc_set_status(ms);
-			return ;
+			lines++;
+			if (lines == max)
+				break ;
 		}
-		add_history(trimmed);
-		fill_ms_history_line(trimmed, ms);
-		free(buf);
-		free(trimmed);
+		i--;
 	}
+	return (i);
 }
 
 /**
- * @brief Opens the history file for reading and puts its contents into the 
- *        shell structure.
+ * @brief Adds one line read from the history file to both histories.
  * 
- * This function attempts to open the history file in read-only mode. If 
- * the file does not exist, it creates an empty history file with 
- * appropriate permissions. If the file exists, its content is read and 
- * stored in the shell's history structure.
- * 
- * @param ms Pointer to the shell structure where the history will be stored.
+ * @param line The NUL-terminated line.
+ * @param ms Pointer to the shell structure where the history is stored.
+ */
+static void	load_line(char *line, t_ms *ms)
+{
+	if (line[0] == '\0')
+		return ;
+	add_history(line);
+	fill_ms_history_line(line, ms);
+	ms->history_lines++;
+}
+
+/**
+ * @brief Loads the tail of the mapped history file in a single pass.
  * 
- * @return SUCCESS on successful execution.
+ * The file is mapped privately and writable, so every newline can be turned 
+ * into a terminator in place and the lines are handed over without an extra 
+ * copy. A last line without a newline, which may reach the end of the 
+ * mapping, is copied instead. If older lines were skipped, the line count is 
+ * raised so the file gets compacted soon.
  * 
- * @note If the file does not exist, it is created but remains empty.
+ * @param map The mapped history file.
+ * @param size The size of the file in bytes.
+ * @param ms Pointer to the shell structure where the history is stored.
  */
-t_bool	open_read_history_file(t_ms *ms)
+static void	load_history_lines(char *map, size_t size, t_ms *ms)
 {
-	int	fd;
+	char	*cur;
+	char	*end;
+	char	*nl;
 
-	fd = open(HISTORY_FILE, O_RDONLY);
-	if (fd < 0)
+	cur = map + history_tail(map, size, ms->hist.max);
+	end = map + size;
+	if (cur != map)
+		ms->history_lines = ms->hist.max;
+	while (cur < end && ms->exit_status != MALLOC_ERR)
 	{
-		fd = open(HISTORY_FILE, O_CREAT, 0644);
-		close(fd);
-		return (0);
+		nl = ft_memchr(cur, '\n', end - cur);
+		if (!nl)
+		{
+			nl = ft_substr(cur, 0, end - cur);
+			if (!nl)
+				print_malloc_set_status(ms);
+			else
+				load_line(nl, ms);
+			free(nl);
+			return ;
+		}
+		*nl = '\0';
+		load_line(cur, ms);
+		cur = nl + 1;
 	}
-	read_from_history_file(fd, ms);
-	close(fd);
-	return (0);
 }
 
 /**
- * @brief Writes the shell history to the history file.
+ * @brief Opens the history file and loads its contents into the shell 
+ *        structure.
  * 
- * This function opens the history file in truncate mode and writes the 
- * stored history from the shell structure into the file. The history is 
- * written line by line.
+ * The file is created if it does not exist and stays open in append mode for 
+ * the whole session, so every accepted line can be written to it right away. 
+ * Its absolute path is remembered for compaction, which keeps working after 
+ * `cd`. The existing contents are read through a memory mapping. A missing 
+ * final newline is added so the next appended line starts on its own line.
  * 
- * @param ms Pointer to the shell structure containing the command history.
+ * @param ms Pointer to the shell structure where the history will be stored.
  * 
- * @note The function overwrites the existing history file.
+ * @return 0 on success, 1 if the history file could not be opened.
  */
-void	write_to_history_file(t_ms *ms)
+t_bool	open_read_history_file(t_ms *ms)
 {
-	int	fd;
-	int	i;
+	struct stat	st;
+	char		*map;
 
-	fd = open(HISTORY_FILE, O_TRUNC | O_RDWR);
-	if (fd < 0)
-		return ;
-	i = 0;
-	while (i < HISTORY_SIZE)
+	ms->history_path = ft_strjoin(ms->pwd, "/" HISTORY_FILE);
+	if (!ms->history_path)
+		return (1);
+	ms->history_fd = open(ms->history_path,
+			O_RDWR | O_CREAT | O_APPEND | O_CLOEXEC, 0644);
+	if (ms->history_fd < 0)
+		return (1);
+	if (fstat(ms->history_fd, &st) == 0 && st.st_size > 0)
 	{
-		if (ms->history[ms->history_num])
-			ft_putendl_fd(ms->history[ms->history_num], fd);
-		if (ms->history_num == HISTORY_SIZE - 1)
-			ms->history_num = 0;
-		else
-			ms->history_num++;
-		i++;
+		map = mmap(NULL, st.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE,
+				ms->history_fd, 0);
+		if (map != MAP_FAILED)
+		{
+			if (map[st.st_size - 1] != '\n')
+				write(ms->history_fd, "\n", 1);
+			load_history_lines(map, st.st_size, ms);
+			munmap(map, st.st_size);
+		}
 	}
-	close(fd);
+	return (0);
 }
@@ -0,0 +1,135 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   history_index.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: agent <agent@local>                        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 01:42:37 by agent             #+#    #+#             */
+/*   Updated: 2026/10/17 01:42:37 by agent            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../include/minishell.h"
+
+/**
+ * @brief Hashes a history line with the djb2 function.
+ * 
+ * The full hash is stored in each entry, so the index can be rehashed and 
+ * lookups can skip most string comparisons.
+ * 
+ * @param line The history line to hash.
+ * 
+ * @return The hash value.
+ */
+size_t	history_hash(const char *line)
+{
+	size_t	hash;
+
+	hash = 5381;
+	while (*line)
+		hash = hash * 33 + (unsigned char)*line++;
+	return (hash);
+}
+
+/**
+ * @brief Doubles the bucket array and rehashes every live entry.
+ * 
+ * The index starts with `HIST_BUCKETS` buckets and grows whenever it holds 
+ * as many entries as buckets, so chains stay short however large `HISTSIZE` 
+ * is set.
+ * 
+ * @param h A pointer to the history.
+ * 
+ * @return `1` on success, `0` if the allocation fails.
+ */
+static int	index_grow(t_history *h)
+{
+	t_hent	**buckets;
+	t_hent	*e;
+	size_t	size;
+	size_t	seq;
+
+	size = h->size * 2;
+	if (size == 0)
+		size = HIST_BUCKETS;
+	buckets = (t_hent **)ft_calloc(size, sizeof(t_hent *));
+	if (!buckets)
+		return (0);
+	seq = h->first;
+	while (seq < h->end)
+	{
+		e = h->ring[seq++ & (h->cap - 1)];
+		if (e)
+		{
+			e->hnext = buckets[e->hash & (size - 1)];
+			buckets[e->hash & (size - 1)] = e;
+		}
+	}
+	free(h->buckets);
+	h->buckets = buckets;
+	h->size = size;
+	return (1);
+}
+
+/**
+ * @brief Adds an entry to the duplicate index.
+ * 
+ * A failed resize is not fatal as long as some buckets exist; the chains 
+ * just get longer.
+ * 
+ * @param h A pointer to the history.
+ * @param e The entry to index. Its `hash` must already be set.
+ * 
+ * @return `1` on success, `0` if the index could not be allocated at all.
+ */
+int	history_index_insert(t_history *h, t_hent *e)
+{
+	size_t	idx;
+
+	if (h->live >= h->size && !index_grow(h) && !h->buckets)
+		return (0);
+	idx = e->hash & (h->size - 1);
+	e->hnext = h->buckets[idx];
+	h->buckets[idx] = e;
+	return (1);
+}
+
+/**
+ * @brief Removes an entry from the duplicate index.
+ * 
+ * @param h A pointer to the history.
+ * @param e The entry to remove.
+ */
+void	history_index_remove(t_history *h, t_hent *e)
+{
+	t_hent	**link;
+
+	link = &h->buckets[e->hash & (h->size - 1)];
+	while (*link && *link != e)
+		link = &(*link)->hnext;
+	if (*link)
+		*link = e->hnext;
+}
+
+/**
+ * @brief Looks up a line in the history.
+ * 
+ * @param h A pointer to the history.
+ * @param line The line to look for.
+ * 
+ * @return The most recently indexed entry holding `line`, or NULL.
+ */
+t_hent	*history_find(t_history *h, const char *line)
+{
+	t_hent	*e;
+	size_t	hash;
+
+	if (!h->buckets)
+		return (NULL);
+	hash = history_hash(line);
+	e = h->buckets[hash & (h->size - 1)];
+	while (e && (e->hash != hash || ft_strcmp(e->line, line) != 0))
+		e = e->hnext;
+	return (e);
+}
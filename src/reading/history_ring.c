@@ -0,0 +1,145 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   history_ring.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: agent <agent@local>                        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 01:42:37 by agent             #+#    #+#             */
+/*   Updated: 2026/10/17 01:42:37 by agent            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../include/minishell.h"
+
+/**
+ * @brief Moves the live entries into a new ring, dropping erased slots.
+ * 
+ * Entries keep their order and are renumbered from 0.
+ * 
+ * @param h A pointer to the history.
+ * @param ring The new ring array.
+ * @param cap The capacity of the new ring, a power of two.
+ */
+static void	ring_rebuild(t_history *h, t_hent **ring, size_t cap)
+{
+	t_hent	*e;
+	size_t	seq;
+	size_t	n;
+
+	n = 0;
+	seq = h->first;
+	while (seq < h->end)
+	{
+		e = h->ring[seq & (h->cap - 1)];
+		if (e)
+		{
+			e->seq = n;
+			ring[n++] = e;
+		}
+		seq++;
+	}
+	free(h->ring);
+	h->ring = ring;
+	h->cap = cap;
+	h->first = 0;
+	h->end = n;
+}
+
+/**
+ * @brief Makes sure the ring has a free slot at its end.
+ * 
+ * Slots of erased duplicates are only reclaimed here: if at least half of 
+ * the ring is erased slots, it is compacted at the same size, otherwise its 
+ * capacity doubles. Either way each push costs amortized constant time.
+ * 
+ * @param h A pointer to the history.
+ * 
+ * @return `1` on success, `0` if the allocation fails.
+ */
+static int	ring_reserve(t_history *h)
+{
+	t_hent	**ring;
+	size_t	cap;
+
+	if (h->end - h->first < h->cap)
+		return (1);
+	cap = h->cap;
+	if (h->live * 2 > h->cap)
+		cap = h->cap * 2;
+	if (cap == 0)
+		cap = HIST_RING_MIN;
+	ring = (t_hent **)malloc(cap * sizeof(t_hent *));
+	if (!ring)
+		return (0);
+	ring_rebuild(h, ring, cap);
+	return (1);
+}
+
+/**
+ * @brief Removes an entry from the history.
+ * 
+ * The ring slot is cleared rather than closed up, which keeps removal in 
+ * constant time; erased slots at the front are skipped right away.
+ * 
+ * @param h A pointer to the history.
+ * @param e The entry to remove.
+ */
+void	history_erase(t_history *h, t_hent *e)
+{
+	h->ring[e->seq & (h->cap - 1)] = NULL;
+	history_index_remove(h, e);
+	free(e);
+	h->live--;
+	while (h->first < h->end && !h->ring[h->first & (h->cap - 1)])
+		h->first++;
+}
+
+/**
+ * @brief Drops the oldest entries until the history fits in `HISTSIZE`.
+ * 
+ * @param h A pointer to the history.
+ */
+void	history_trim(t_history *h)
+{
+	while (h->live > h->max)
+		history_erase(h, h->ring[h->first & (h->cap - 1)]);
+}
+
+/**
+ * @brief Appends a line to the history.
+ * 
+ * The entry and a copy of the line share one allocation. The oldest entries 
+ * are evicted afterwards if the history grew past its limit.
+ * 
+ * @param h A pointer to the history.
+ * @param line The line to store.
+ * 
+ * @return `1` on success, `0` if an allocation fails.
+ */
+int	history_push(t_history *h, const char *line)
+{
+	t_hent	*e;
+	size_t	len;
+
+	if (!ring_reserve(h))
+		return (0);
+	len = ft_strlen(line);
+	e = (t_hent *)malloc(sizeof(t_hent) + len + 1);
+	if (!e)
+		return (0);
+	e->line = (char *)(e + 1);
+	ft_memcpy(e->line, line, len + 1);
+	e->hash = history_hash(line);
+	if (!history_index_insert(h, e))
+	{
+		free(e);
+		return (0);
+	}
+	e->seq = h->end;
+	h->ring[h->end & (h->cap - 1)] = e;
+	h->end++;
+	h->live++;
+	history_trim(h);
+	return (1);
+}
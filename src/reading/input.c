@@ -0,0 +1,91 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   input.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: agent <agent@local>                        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 01:03:12 by agent             #+#    #+#             */
+/*   Updated: 2026/10/17 03:34:36 by agent            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../include/minishell.h"
+
+/**
+ * @brief Reads the next command line from the user or from the input stream.
+ * 
+ * On a terminal the line is read with `readline`. Otherwise the line comes 
+ * from the shell's buffered line reader, which is created on first use and 
+ * kept in the `t_ms` structure for the rest of the session. The read is 
+ * traced.
+ * 
+ * @param ms A pointer to the shell structure.
+ * 
+ * @return The newly allocated line, or NULL at end of input or on failure.
+ */
+char	*read_input_line(t_ms *ms)
+{
+	char		*line;
+	long long	start;
+
+	start = trace_begin(ms);
+	if (!ms->reader && !isatty(STDIN_FILENO))
+	{
+		ms->reader = reader_init(STDIN_FILENO);
+		if (!ms->reader)
+			return (print_malloc_set_status(ms));
+	}
+	if (ms->reader)
+		line = reader_next_line(ms->reader, ms);
+	else
+		line = readline("minishell> ");
+	trace_end(ms, "read", start, 0);
+	return (line);
+}
+
+/**
+ * @brief Event hook that lets `readline` notice an interrupted heredoc.
+ * 
+ * While a hook is installed, `readline` polls for input and checks `rl_done` 
+ * between polls, which the heredoc SIGINT handler sets.
+ * 
+ * @return Always `0`.
+ */
+static int	heredoc_event_hook(void)
+{
+	return (0);
+}
+
+/**
+ * @brief Reads the next line of heredoc input.
+ * 
+ * On a terminal the line is read with `readline` and the `> ` prompt while the 
+ * heredoc signal handler is active, so Ctrl+C makes `readline` return and 
+ * leaves `g_sgnl` set to SIGINT. The previous handlers are saved before and 
+ * restored afterwards, so reading a heredoc never changes how the shell reacts 
+ * to signals later. Otherwise the line comes from the same line reader as the 
+ * commands, so heredocs in scripts read the lines that follow the command.
+ * 
+ * @param ms A pointer to the shell structure.
+ * 
+ * @return The newly allocated line, or NULL at end of input or on failure.
+ */
+char	*read_heredoc_line(t_ms *ms)
+{
+	struct sigaction	old_int;
+	struct sigaction	old_quit;
+	char				*line;
+
+	if (ms->reader || !isatty(STDIN_FILENO))
+		return (read_input_line(ms));
+	sigaction(SIGINT, NULL, &old_int);
+	sigaction(SIGQUIT, NULL, &old_quit);
+	signal_mode(HEREDOC_MODE);
+	rl_event_hook = heredoc_event_hook;
+	line = readline("> ");
+	rl_event_hook = NULL;
+	sigaction(SIGINT, &old_int, NULL);
+	sigaction(SIGQUIT, &old_quit, NULL);
+	return (line);
+}
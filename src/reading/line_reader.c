@@ -0,0 +1,170 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   line_reader.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: agent <agent@local>                        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 01:03:12 by agent             #+#    #+#             */
+/*   Updated: 2026/10/17 03:37:20 by agent            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <errno.h>
+#include "../../include/minishell.h"
+
+/**
+ * @brief Creates a line reader bound to a file descriptor.
+ * 
+ * The reader owns one buffer of `READER_SIZE` bytes that is reused for the 
+ * whole session, so reading a line no longer costs a fresh buffer allocation 
+ * and a stash reallocation like `get_next_line` does.
+ * 
+ * @param fd The file descriptor the reader pulls its input from.
+ * 
+ * @return A pointer to the new reader, or NULL if an allocation failed.
+ */
+t_reader	*reader_init(int fd)
+{
+	t_reader	*reader;
+
+	reader = malloc(sizeof(t_reader));
+	if (!reader)
+		return (NULL);
+	reader->buf = malloc(READER_SIZE);
+	if (!reader->buf)
+	{
+		free(reader);
+		return (NULL);
+	}
+	reader->fd = fd;
+	reader->cap = READER_SIZE;
+	reader->start = 0;
+	reader->end = 0;
+	reader->eof = false;
+	return (reader);
+}
+
+/**
+ * @brief Makes room in the buffer and reads the next chunk of input.
+ * 
+ * Unconsumed bytes are first moved to the front of the buffer. The buffer 
+ * is only grown (doubled) when a single line does not fit into it.
+ * 
+ * @param reader A pointer to the reader to refill.
+ * 
+ * @return The number of bytes read, 0 at end of input, or -1 on failure.
+ */
+static ssize_t	reader_fill(t_reader *reader)
+{
+	char	*bigger;
+
+	if (reader->start > 0)
+	{
+		ft_memmove(reader->buf, reader->buf + reader->start,
+			reader->end - reader->start);
+		reader->end -= reader->start;
+		reader->start = 0;
+	}
+	if (reader->end == reader->cap)
+	{
+		bigger = malloc(reader->cap * 2);
+		if (!bigger)
+			return (-1);
+		ft_memcpy(bigger, reader->buf, reader->end);
+		free(reader->buf);
+		reader->buf = bigger;
+		reader->cap *= 2;
+	}
+	return (read(reader->fd, reader->buf + reader->end,
+			reader->cap - reader->end));
+}
+
+/**
+ * @brief Copies the next `len` buffered bytes out as a new string.
+ * 
+ * @param reader A pointer to the reader.
+ * @param len The length of the line, without its newline.
+ * @param skip The number of bytes to consume after the line (1 for the 
+ *             newline, 0 for the last line of the input).
+ * @param ms A pointer to the shell structure, used to report a failed 
+ *           allocation.
+ * 
+ * @return The newly allocated line, or NULL if the allocation failed.
+ */
+static char	*reader_cut(t_reader *reader, size_t len, size_t skip, t_ms *ms)
+{
+	char	*line;
+
+	line = malloc(len + 1);
+	if (!line)
+		return (print_malloc_set_status(ms));
+	ft_memcpy(line, reader->buf + reader->start, len);
+	line[len] = '\0';
+	reader->start += len + skip;
+	return (line);
+}
+
+/**
+ * @brief Returns the next line of input without its trailing newline.
+ * 
+ * The buffered bytes are scanned for a newline with `ft_memchr`, and the 
+ * buffer is only refilled when no complete line is left in it. A last line 
+ * without a newline is returned as it is once the input is exhausted. A 
+ * read interrupted by a signal is retried; any other failure is reported 
+ * and sets the exit status to `SYSTEM_ERR`, so the shell does not mistake 
+ * it for the end of a script.
+ * 
+ * @param reader A pointer to the reader.
+ * @param ms A pointer to the shell structure, used to report a failed 
+ *           read or allocation.
+ * 
+ * @return The newly allocated line, or NULL at end of input or on failure.
+ */
+char	*reader_next_line(t_reader *reader, t_ms *ms)
+{
+	char	*nl;
+	ssize_t	bytes;
+
+	nl = ft_memchr(reader->buf + reader->start, '\n',
+			reader->end - reader->start);
+	while (!nl && !reader->eof)
+	{
+		bytes = reader_fill(reader);
+		if (bytes < 0 && errno != EINTR)
+		{
+			print_system_error(INPUT_RD_ERR);
+			ms->exit_status = SYSTEM_ERR;
+			return (NULL);
+		}
+		reader->eof = (bytes == 0);
+		if (bytes > 0)
+			reader->end += bytes;
+		nl = ft_memchr(reader->buf + reader->start, '\n',
+				reader->end - reader->start);
+	}
+	if (nl)
+		return (reader_cut(reader, nl - (reader->buf + reader->start), 1, ms));
+	if (reader->start < reader->end)
+		return (reader_cut(reader, reader->end - reader->start, 0, ms));
+	return (NULL);
+}
+
+/**
+ * @brief Frees a line reader and its buffer.
+ * 
+ * A script file opened for the reader is closed as well; the standard 
+ * input is left open.
+ * 
+ * @param reader A pointer to the reader pointer; it is set to NULL.
+ */
+void	reader_free(t_reader **reader)
+{
+	if (!*reader)
+		return ;
+	if ((*reader)->fd > STDERR_FILENO)
+		close((*reader)->fd);
+	free((*reader)->buf);
+	free(*reader);
+	*reader = NULL;
+}
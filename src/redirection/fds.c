@@ -6,7 +6,7 @@
 /*   By: ssalorin <ssalorin@student.hive.fi>        +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/03/27 14:22:54 by ssalorin          #+#    #+#             */
-/*   Updated: 2025/03/27 14:22:56 by ssalorin         ###   ########.fr       */
+/*   Updated: 2026/10/17 03:12:43 by agent            ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -54,7 +54,8 @@ void	check_access(char *filename, t_oper operation)
  * the specified delimiter. If an input file descriptor is already open, 
  * it is closed first. In case of an ambiguous redirection, an error is 
  * printed, and the input descriptor is set to an invalid state. Otherwise, 
- * the heredoc content is processed and assigned to the command's input.
+ * the heredoc body read with the line is assigned to the command's input; 
+ * the descriptor itself is owned by the heredoc registry.
  * 
  * @param token A pointer to the token containing heredoc information.
  * @param cmd A pointer to the command structure where the input 
@@ -63,8 +64,7 @@ void	check_access(char *filename, t_oper operation)
  */
 void	put_heredoc_fd(t_token *token, t_cmd *cmd, t_ms *ms)
 {
-	if (cmd->infile > 0)
-		close(cmd->infile);
+	release_infile(ms, cmd);
 	if (token->ambiguous)
 	{
 		cmd->infile = NO_FD;
@@ -72,7 +72,8 @@ void	put_heredoc_fd(t_token *token, t_cmd *cmd, t_ms *ms)
 	}
 	else
 	{
-		cmd->infile = handle_heredoc(ms, token->file, token);
+		cmd->infile = handle_heredoc(ms, token);
+		cmd->heredoc = (cmd->infile >= 0);
 	}
 }
 
@@ -123,11 +124,11 @@ void	put_outfile_fd(t_token *token, t_cmd *cmd)
  * @param token A pointer to the token containing file information.
  * @param cmd A pointer to the command structure where the input 
  * descriptor is stored.
+ * @param ms A pointer to the shell structure.
  */
-void	put_infile_fd(t_token *token, t_cmd *cmd)
+void	put_infile_fd(t_token *token, t_cmd *cmd, t_ms *ms)
 {
-	if (cmd->infile > 0)
-		close(cmd->infile);
+	release_infile(ms, cmd);
 	if (token->ambiguous)
 	{
 		cmd->infile = NO_FD;
@@ -0,0 +1,84 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   heredoc_fd.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: agent <agent@local>                        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 01:21:57 by agent             #+#    #+#             */
+/*   Updated: 2026/10/17 01:21:57 by agent            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef _GNU_SOURCE
+# define _GNU_SOURCE
+#endif
+#include <sys/mman.h>
+#include "../../include/minishell.h"
+
+/**
+ * @brief Writes a whole buffer to a file descriptor.
+ * 
+ * @param fd The file descriptor to write to.
+ * @param buf The bytes to write.
+ * @param len The number of bytes to write.
+ * 
+ * @return `1` on success, `0` if a write fails.
+ */
+static int	write_all(int fd, const char *buf, size_t len)
+{
+	ssize_t	written;
+
+	while (len > 0)
+	{
+		written = write(fd, buf, len);
+		if (written < 0)
+			return (0);
+		buf += written;
+		len -= written;
+	}
+	return (1);
+}
+
+/**
+ * @brief Opens an anonymous file that lives only as long as its descriptors.
+ * 
+ * A `memfd_create` file is kept in memory. On kernels without it, an unnamed 
+ * `O_TMPFILE` file in `HEREDOC_TMPDIR` is used instead. Neither ever has a 
+ * name in the filesystem, so there is nothing to clean up.
+ * 
+ * @return The file descriptor, or -1 on failure.
+ */
+static int	open_anonymous_file(void)
+{
+	int		fd;
+
+	fd = memfd_create("heredoc", MFD_CLOEXEC);
+	if (fd < 0)
+		fd = open(HEREDOC_TMPDIR, O_TMPFILE | O_RDWR | O_CLOEXEC, 0600);
+	return (fd);
+}
+
+/**
+ * @brief Stores a heredoc body in an anonymous file and rewinds it.
+ * 
+ * @param body The string builder holding the heredoc body.
+ * @param ms A pointer to the main shell structure.
+ * 
+ * @return A file descriptor positioned at the start of the body, or -1 if an 
+ *         error occurs (the exit status is then set to 1).
+ */
+int	heredoc_to_fd(t_strbuf *body, t_ms *ms)
+{
+	int		fd;
+
+	fd = open_anonymous_file();
+	if (fd >= 0 && write_all(fd, body->buf, body->len)
+		&& lseek(fd, 0, SEEK_SET) == 0)
+		return (fd);
+	perror("heredoc");
+	if (fd >= 0)
+		close(fd);
+	ms->exit_status = 1;
+	return (NO_FD);
+}
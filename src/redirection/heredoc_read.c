@@ -0,0 +1,167 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   heredoc_read.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: agent <agent@local>                        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 03:12:43 by agent             #+#    #+#             */
+/*   Updated: 2026/10/17 03:12:43 by agent            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../include/minishell.h"
+
+/**
+ * @brief Builds a heredoc limiter from the segments of its word.
+ * 
+ * Quotes are not part of the segments, so joining them gives the limiter 
+ * with its quotes removed and nothing expanded, as bash does.
+ * 
+ * @param word A pointer to the word that follows the `<<` operator.
+ * @param ms A pointer to the main shell structure.
+ * 
+ * @return The limiter, allocated in the line arena, or NULL if the 
+ *         allocation fails.
+ */
+static char	*heredoc_limiter(t_token *word, t_ms *ms)
+{
+	t_seg	*seg;
+	char	*lim;
+	size_t	len;
+
+	len = 0;
+	seg = word->segs;
+	while (seg)
+	{
+		len += seg->len;
+		seg = seg->next;
+	}
+	lim = arena_alloc(ms, len + 1);
+	if (!lim)
+		return (NULL);
+	len = 0;
+	seg = word->segs;
+	while (seg)
+	{
+		ft_memcpy(lim + len, seg->start, seg->len);
+		len += seg->len;
+		seg = seg->next;
+	}
+	lim[len] = '\0';
+	return (lim);
+}
+
+/**
+ * @brief Reads heredoc lines until the limiter and collects them unexpanded.
+ * 
+ * Each line is terminated with a newline, as it was read. If Ctrl+C is 
+ * pressed, the input is discarded. If EOF (Ctrl+D) is encountered, a warning 
+ * is printed and the body read so far is kept.
+ * 
+ * @param body The string builder receiving the heredoc body.
+ * @param lim The delimiter string that marks the end of heredoc input.
+ * @param ms A pointer to the main shell structure.
+ * 
+ * @return `1` on success, `0` if memory allocation fails, or 
+ *         `SIGNAL_HEREDOC` if the input was interrupted.
+ */
+static int	collect_body(t_strbuf *body, char *lim, t_ms *ms)
+{
+	char	*line;
+
+	while (1)
+	{
+		line = read_heredoc_line(ms);
+		if (g_sgnl == SIGINT)
+		{
+			free(line);
+			return (SIGNAL_HEREDOC);
+		}
+		if (!line)
+		{
+			if (ms->exit_status == MALLOC_ERR)
+				return (0);
+			print_heredoc_ctrl_d(lim);
+			return (1);
+		}
+		if (ft_strcmp(line, lim) == 0
+			|| !sb_append(body, line, ft_strlen(line), ms)
+			|| !sb_putc(body, '\n', ms))
+			break ;
+		free(line);
+	}
+	free(line);
+	return (ms->exit_status != MALLOC_ERR);
+}
+
+/**
+ * @brief Reads the body of one heredoc and stores it on its operator.
+ * 
+ * @param op A pointer to the `<<` operator token receiving the body.
+ * @param word A pointer to the limiter word that follows it.
+ * @param ms A pointer to the main shell structure.
+ * 
+ * @return `1` on success, `0` on failure, or `SIGNAL_HEREDOC` if the 
+ *         input was interrupted.
+ */
+static int	read_one_heredoc(t_token *op, t_token *word, t_ms *ms)
+{
+	t_strbuf	body;
+	char		*lim;
+	int			ret;
+
+	lim = heredoc_limiter(word, ms);
+	if (!lim || !sb_init(&body, STRBUF_SIZE, ms))
+		return (0);
+	ret = collect_body(&body, lim, ms);
+	if (ret == 1)
+	{
+		op->body = arena_strndup(ms, body.buf, body.len);
+		if (!op->body)
+			ret = 0;
+	}
+	sb_free(&body);
+	return (ret);
+}
+
+/**
+ * @brief Reads the bodies of all heredocs on a command line.
+ * 
+ * Like bash, the shell reads every heredoc right after the line is parsed, 
+ * before any of its commands runs. The bodies are therefore consumed even 
+ * when `&&` or `||` skips their pipeline, or when the pipeline runs in the 
+ * background, so their lines are never taken for commands. The bodies are 
+ * kept unexpanded on the `<<` tokens and expanded when the pipeline is 
+ * built. If Ctrl+C is pressed, the exit status becomes 130 and the whole 
+ * line is skipped.
+ * 
+ * @param ms A pointer to the main shell structure.
+ * @param toks A pointer to the raw token vector of the line.
+ * 
+ * @return `1` if every body was read, `0` on failure or interruption.
+ */
+int	read_heredocs(t_ms *ms, t_tokens *toks)
+{
+	size_t	i;
+	int		ret;
+
+	i = 0;
+	while (i + 1 < toks->len)
+	{
+		if (toks->arr[i].type == HEREDOC && toks->arr[i + 1].type == WORD)
+		{
+			ret = read_one_heredoc(&toks->arr[i], &toks->arr[i + 1], ms);
+			if (ret == SIGNAL_HEREDOC)
+			{
+				ms->exit_status = 130;
+				g_sgnl = 0;
+			}
+			if (ret != 1)
+				return (0);
+			i++;
+		}
+		i++;
+	}
+	return (1);
+}
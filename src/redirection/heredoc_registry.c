@@ -0,0 +1,135 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   heredoc_registry.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: agent <agent@local>                        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 01:25:15 by agent             #+#    #+#             */
+/*   Updated: 2026/10/17 01:25:15 by agent            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../include/minishell.h"
+
+/**
+ * @brief Makes room for at least one more descriptor in the registry.
+ * 
+ * The capacity doubles each time it runs out, so appending is amortized 
+ * constant time however many heredocs a line contains.
+ * 
+ * @param reg A pointer to the heredoc registry.
+ * 
+ * @return `1` on success, `0` if the allocation fails.
+ */
+static int	registry_grow(t_heredocs *reg)
+{
+	int		*fds;
+	size_t	cap;
+
+	if (reg->count < reg->cap)
+		return (1);
+	cap = reg->cap * 2;
+	if (cap == 0)
+		cap = 16;
+	fds = (int *)malloc(cap * sizeof(int));
+	if (!fds)
+		return (0);
+	if (reg->fds)
+		ft_memcpy(fds, reg->fds, reg->count * sizeof(int));
+	free(reg->fds);
+	reg->fds = fds;
+	reg->cap = cap;
+	return (1);
+}
+
+/**
+ * @brief Hands ownership of a heredoc descriptor to the registry.
+ * 
+ * Every heredoc opened for the current line is recorded here, so that 
+ * `reset_heredocs` can close all of them in one go, whether the line ran to 
+ * completion or was abandoned half-way through building its commands.
+ * 
+ * @param ms A pointer to the main shell structure.
+ * @param fd The heredoc descriptor to register.
+ * 
+ * @return `fd`, or `NO_FD` if the registry could not grow (the descriptor 
+ *         is then closed and the malloc error status set).
+ */
+int	heredoc_register(t_ms *ms, int fd)
+{
+	if (!registry_grow(&ms->heredocs))
+	{
+		close(fd);
+		print_malloc_set_status(ms);
+		return (NO_FD);
+	}
+	ms->heredocs.fds[ms->heredocs.count++] = fd;
+	return (fd);
+}
+
+/**
+ * @brief Closes a command's input before another redirection replaces it.
+ * 
+ * Commands are built one after another, so a heredoc that is still a 
+ * command's input is always the last one registered; dropping it from the 
+ * registry is a simple pop. This keeps at most one heredoc open per command.
+ * 
+ * @param ms A pointer to the main shell structure.
+ * @param cmd The command whose input is being replaced.
+ */
+void	release_infile(t_ms *ms, t_cmd *cmd)
+{
+	t_heredocs	*reg;
+
+	reg = &ms->heredocs;
+	if (cmd->heredoc && reg->count
+		&& reg->fds[reg->count - 1] == cmd->infile)
+		reg->count--;
+	if (cmd->infile > 0)
+		close(cmd->infile);
+	cmd->heredoc = false;
+}
+
+/**
+ * @brief Closes every heredoc descriptor opened for the current line.
+ * 
+ * The array itself is kept for the next line and only freed together with 
+ * the shell structure.
+ * 
+ * @param ms A pointer to the main shell structure.
+ */
+void	reset_heredocs(t_ms *ms)
+{
+	while (ms->heredocs.count > 0)
+		close(ms->heredocs.fds[--ms->heredocs.count]);
+}
+
+/**
+ * @brief Returns the maximum number of heredocs allowed on one line.
+ * 
+ * The limit is read from the `HEREDOC_MAX` variable, so scripts that batch 
+ * many heredocs can raise it. An unset, empty or non-positive value falls 
+ * back to the built-in default.
+ * 
+ * @param ms A pointer to the main shell structure.
+ * 
+ * @return The heredoc ceiling for the current line.
+ */
+size_t	heredoc_ceiling(t_ms *ms)
+{
+	char	*value;
+	int		i;
+	int		max;
+
+	value = get_env_value(HEREDOC_MAX_VAR, ms);
+	if (!value || !*value)
+		return (HEREDOC_MAX);
+	i = 0;
+	while (ft_isdigit(value[i]))
+		i++;
+	max = ft_atoi(value);
+	if (value[i] || i > 9 || max <= 0)
+		return (HEREDOC_MAX);
+	return ((size_t)max);
+}
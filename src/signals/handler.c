@@ -6,7 +6,7 @@
 /*   By: ssalorin <ssalorin@student.hive.fi>        +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/03/27 14:29:29 by ssalorin          #+#    #+#             */
-/*   Updated: 2025/03/27 14:29:31 by ssalorin         ###   ########.fr       */
+/*   Updated: 2026/10/17 01:21:57 by agent            ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -73,24 +73,21 @@ void	print_heredoc_ctrl_d(char *limiter)
  * @brief Handles the SIGINT signal during heredoc input.
  * 
  * This function is invoked when a SIGINT signal (e.g., from Ctrl+C) is 
- * received during the heredoc process. It outputs a newline to STDERR, 
- * closes the standard input stream to stop further reading, sets a global 
- * signal flag `g_sgnl` to SIGINT, and terminates the program with an exit 
- * status of 130 to indicate the signal was caught.
+ * received while the shell reads heredoc input. It sets the global signal 
+ * flag `g_sgnl` to SIGINT and sets `rl_done`, so that `readline` returns 
+ * (printing the newline) on its next event-hook check instead of waiting for 
+ * more input.
  * 
  * @param sig The signal number. It checks if the signal is SIGINT (Ctrl+C).
  * 
- * @return None. The function exits the program with a status code of 130 
- *         after handling the signal.
+ * @return None.
  */
 static void	ctrlc_heredoc(int sig)
 {
 	if (sig == SIGINT)
 	{
-		write(STDERR_FILENO, "\n", 1);
-		close(STDIN_FILENO);
 		g_sgnl = SIGINT;
-		exit(130);
+		rl_done = 1;
 	}
 }
 
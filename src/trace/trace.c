@@ -0,0 +1,142 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   trace.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: agent <agent@local>                        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 02:31:20 by agent             #+#    #+#             */
+/*   Updated: 2026/10/17 03:16:31 by agent            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../include/minishell.h"
+
+/**
+ * @brief Reads the monotonic clock.
+ * 
+ * @return The current time in nanoseconds.
+ */
+long long	trace_now(void)
+{
+	struct timespec	ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ((long long)ts.tv_sec * 1000000000LL + ts.tv_nsec);
+}
+
+/**
+ * @brief Starts timing a traced phase.
+ * 
+ * The tracer is opt-in: while it is off this is a single test, so the 
+ * calls can stay in the hot paths.
+ * 
+ * @param ms A pointer to the main shell structure.
+ * 
+ * @return The start time, or 0 when tracing is off.
+ */
+long long	trace_begin(t_ms *ms)
+{
+	if (!ms->trace.on)
+		return (0);
+	return (trace_now());
+}
+
+/**
+ * @brief Makes room for one more event.
+ * 
+ * The event table doubles from `TRACE_MIN` entries and stops growing at 
+ * `TRACE_MAX`, so a forgotten tracer cannot eat the memory of a long 
+ * session.
+ * 
+ * @param tr A pointer to the tracer.
+ * 
+ * @return 1 if there is room, 0 if the event has to be dropped.
+ */
+static int	trace_reserve(t_trace *tr)
+{
+	t_event	*bigger;
+	size_t	cap;
+
+	if (tr->len < tr->cap)
+		return (1);
+	if (tr->cap >= TRACE_MAX)
+		return (0);
+	cap = TRACE_MIN;
+	if (tr->cap)
+		cap = tr->cap * 2;
+	bigger = (t_event *)malloc(cap * sizeof(t_event));
+	if (!bigger)
+		return (0);
+	if (tr->len)
+		ft_memcpy(bigger, tr->events, tr->len * sizeof(t_event));
+	free(tr->events);
+	tr->events = bigger;
+	tr->cap = cap;
+	return (1);
+}
+
+/**
+ * @brief Records a finished phase.
+ * 
+ * Nothing is recorded while tracing is off, or for a phase that started 
+ * before it was turned on. Events that do not fit are counted as dropped.
+ * 
+ * @param ms A pointer to the main shell structure.
+ * @param name The name of the phase; it must be a string literal.
+ * @param start The start time returned by `trace_begin`.
+ * @param pid The process the phase concerns, or 0 for the shell itself.
+ */
+void	trace_end(t_ms *ms, const char *name, long long start, pid_t pid)
+{
+	t_event	*ev;
+
+	if (!ms->trace.on || !start)
+		return ;
+	if (!trace_reserve(&ms->trace))
+	{
+		ms->trace.dropped++;
+		return ;
+	}
+	ev = &ms->trace.events[ms->trace.len++];
+	ev->name = name;
+	ev->pid = pid;
+	ev->start = start;
+	ev->end = trace_now();
+}
+
+/**
+ * @brief Records one "wait" span for every reaped child of a pipeline.
+ * 
+ * Each span runs from the start of the wait to the moment its child was 
+ * collected, so a slow stage stands out from the others. Stages that ran 
+ * inside the shell have no child and no span.
+ * 
+ * @param ms A pointer to the main shell structure.
+ * @param start The start time of the wait, returned by `trace_begin`.
+ * @param kids The child table of the pipeline.
+ * @param n The number of stages.
+ */
+void	trace_wait(t_ms *ms, long long start, t_child *kids, int n)
+{
+	t_event	*ev;
+	int		i;
+
+	if (!ms->trace.on || !start)
+		return ;
+	i = 0;
+	while (i < n)
+	{
+		if (kids[i].pid > 0 && !trace_reserve(&ms->trace))
+			ms->trace.dropped++;
+		else if (kids[i].pid > 0)
+		{
+			ev = &ms->trace.events[ms->trace.len++];
+			ev->name = "wait";
+			ev->pid = kids[i].pid;
+			ev->start = start;
+			ev->end = kids[i].reaped;
+		}
+		i++;
+	}
+}
@@ -0,0 +1,136 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   trace_json.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: agent <agent@local>                        +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 02:31:20 by agent             #+#    #+#             */
+/*   Updated: 2026/10/17 03:16:31 by agent            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../include/minishell.h"
+
+/**
+ * @brief Appends a non-negative number in decimal.
+ * 
+ * @param sb A pointer to the output buffer.
+ * @param n The number.
+ * @param width The minimum number of digits, padded with zeros.
+ * @param ms A pointer to the main shell structure.
+ * 
+ * @return 1 on success, 0 if an allocation fails.
+ */
+static int	append_num(t_strbuf *sb, long long n, int width, t_ms *ms)
+{
+	char	digits[24];
+	int		i;
+
+	i = 24;
+	while (n > 0 || 24 - i < width)
+	{
+		digits[--i] = '0' + n % 10;
+		n /= 10;
+	}
+	return (sb_append(sb, digits + i, 24 - i, ms));
+}
+
+/**
+ * @brief Appends a duration in nanoseconds as microseconds.
+ * 
+ * The trace event format counts in microseconds; the three decimals keep 
+ * the nanoseconds the clock gives.
+ * 
+ * @param sb A pointer to the output buffer.
+ * @param ns The duration in nanoseconds.
+ * @param ms A pointer to the main shell structure.
+ * 
+ * @return 1 on success, 0 if an allocation fails.
+ */
+static int	append_usec(t_strbuf *sb, long long ns, t_ms *ms)
+{
+	return (append_num(sb, ns / 1000, 1, ms) && sb_putc(sb, '.', ms)
+		&& append_num(sb, ns % 1000, 3, ms));
+}
+
+/**
+ * @brief Appends one event as a complete ("X") trace event.
+ * 
+ * Shell phases go on the shell's own track and the events of a child on a 
+ * track named after its pid.
+ * 
+ * @param sb A pointer to the output buffer.
+ * @param ev The event.
+ * @param shell The pid of the shell.
+ * @param ms A pointer to the main shell structure.
+ * 
+ * @return 1 on success, 0 if an allocation fails.
+ */
+static int	append_event(t_strbuf *sb, t_event *ev, pid_t shell, t_ms *ms)
+{
+	pid_t	tid;
+
+	tid = shell;
+	if (ev->pid > 0)
+		tid = ev->pid;
+	return (sb_append(sb, "{\"name\":\"", 9, ms)
+		&& sb_append(sb, ev->name, ft_strlen(ev->name), ms)
+		&& sb_append(sb, "\",\"ph\":\"X\",\"ts\":", 16, ms)
+		&& append_usec(sb, ev->start, ms)
+		&& sb_append(sb, ",\"dur\":", 7, ms)
+		&& append_usec(sb, ev->end - ev->start, ms)
+		&& sb_append(sb, ",\"pid\":", 7, ms)
+		&& append_num(sb, shell, 1, ms)
+		&& sb_append(sb, ",\"tid\":", 7, ms)
+		&& append_num(sb, tid, 1, ms) && sb_putc(sb, '}', ms));
+}
+
+/**
+ * @brief Writes the recorded events as JSON.
+ * 
+ * The output is the trace event format that `chrome://tracing` and 
+ * Perfetto load: a `traceEvents` array of complete events with monotonic 
+ * timestamps, plus the number of events dropped when the table was full. 
+ * It is built in memory and written at once.
+ * 
+ * @param ms A pointer to the main shell structure.
+ * @param fd The file descriptor to write to.
+ */
+void	trace_dump(t_ms *ms, int fd)
+{
+	t_strbuf	sb;
+	size_t		i;
+	int			ok;
+
+	if (!sb_init(&sb, 64 + ms->trace.len * 96, ms))
+		return ;
+	ok = sb_append(&sb, "{\"traceEvents\":[", 16, ms);
+	i = 0;
+	while (ok && i < ms->trace.len)
+	{
+		if (i > 0)
+			ok = sb_putc(&sb, ',', ms);
+		ok = ok && append_event(&sb, &ms->trace.events[i++], getpid(), ms);
+	}
+	ok = ok && sb_append(&sb, "],\"dropped\":", 12, ms)
+		&& append_num(&sb, ms->trace.dropped, 1, ms) && sb_putc(&sb, '}', ms)
+		&& sb_putc(&sb, '\n', ms);
+	if (ok)
+		write(fd, sb.buf, sb.len);
+	sb_free(&sb);
+}
+
+/**
+ * @brief Drops every recorded event.
+ * 
+ * @param tr A pointer to the tracer; whether it is on is left alone.
+ */
+void	trace_clear(t_trace *tr)
+{
+	free(tr->events);
+	tr->events = NULL;
+	tr->len = 0;
+	tr->cap = 0;
+	tr->dropped = 0;
+}
@@ -0,0 +1,36 @@
+#!/bin/bash
+
+# Ctrl+C at the prompt must act the same whether or not the line before
+# read a heredoc whose pipeline was skipped. Needs a terminal, so the
+# shell runs under script(1); run from the repository root:
+#   bash test_files/heredoc_sigint.sh [./minishell]
+
+MS=${1:-./minishell}
+
+# Types the given lines, then Ctrl+C, then a command that shows whether
+# the shell survived.
+type_then_ctrlc() {
+	{
+		for line in "$@"
+		do
+			printf '%s\n' "$line"
+			sleep 0.3
+		done
+		sleep 0.3
+		printf '\003'
+		sleep 0.5
+		printf 'echo survived\n'
+		sleep 0.5
+		printf 'exit\n'
+		sleep 0.3
+	} | script -qfec "$MS" /dev/null 2>&1 | grep -ac $'\rsurvived'
+}
+
+without=$(type_then_ctrlc 'true')
+with=$(type_then_ctrlc 'false && cat <<E' 'x' 'E')
+if [[ $with == "$without" ]] ; then
+	echo -e "\033[1;32m✅ SIGINT after a skipped heredoc\033[m"
+	exit 0
+fi
+echo -e "\033[1;31m❌ SIGINT after a skipped heredoc ($with survived, $without expected)\033[m"
+exit 1